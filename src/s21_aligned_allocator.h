@@ -0,0 +1,85 @@
+#ifndef S21_ALIGNED_ALLOCATOR_H_
+#define S21_ALIGNED_ALLOCATOR_H_
+
+#include <cstdint>
+#include <iostream>
+#include <new>
+
+#include "s21_memory.h"
+
+namespace s21 {
+
+// Allocator whose blocks start on an Align-byte boundary, e.g. a cache line
+// or an AVX-512 register. Containers that use it see the alignment through
+// allocator_alignment and hint it to the compiler in data() and begin().
+template <class T, std::size_t Align = 64>
+class aligned_allocator {
+  static_assert(Align != 0 && (Align & (Align - 1)) == 0,
+                "alignment must be a power of two");
+  static_assert(Align >= alignof(T),
+                "alignment must not be weaker than the alignment of T");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  static constexpr size_type alignment = Align;
+
+  template <class U>
+  struct rebind {
+    using other = aligned_allocator<U, Align>;
+  };
+
+  aligned_allocator() noexcept = default;
+  template <class U>
+  aligned_allocator(const aligned_allocator<U, Align> &other) noexcept;
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n) noexcept;
+  size_type max_size() const noexcept;
+
+  bool operator==(const aligned_allocator &other) const noexcept;
+  bool operator!=(const aligned_allocator &other) const noexcept;
+};
+
+template <class T, std::size_t Align>
+template <class U>
+aligned_allocator<T, Align>::aligned_allocator(
+    const aligned_allocator<U, Align> &) noexcept {}
+
+template <class T, std::size_t Align>
+T *aligned_allocator<T, Align>::allocate(size_type n) {
+  if (n > max_size()) throw std::bad_array_new_length();
+  return static_cast<T *>(
+      ::operator new(n * sizeof(T), std::align_val_t(Align)));
+}
+
+template <class T, std::size_t Align>
+void aligned_allocator<T, Align>::deallocate(T *p, size_type) noexcept {
+  ::operator delete(static_cast<void *>(p), std::align_val_t(Align));
+}
+
+template <class T, std::size_t Align>
+typename aligned_allocator<T, Align>::size_type
+aligned_allocator<T, Align>::max_size() const noexcept {
+  return PTRDIFF_MAX / sizeof(T);
+}
+
+template <class T, std::size_t Align>
+bool aligned_allocator<T, Align>::operator==(
+    const aligned_allocator &) const noexcept {
+  return true;
+}
+
+template <class T, std::size_t Align>
+bool aligned_allocator<T, Align>::operator!=(
+    const aligned_allocator &) const noexcept {
+  return false;
+}
+
+}  // namespace s21
+
+#endif  // S21_ALIGNED_ALLOCATOR_H_
@@ -0,0 +1,271 @@
+#ifndef S21_ARENA_H_
+#define S21_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+
+namespace s21 {
+
+// Monotonic memory resource: allocations bump a pointer through a chain of
+// blocks, deallocation does nothing and release() drops every allocation at
+// once. release() keeps the most recent block as a spare so that an arena
+// reused for the next request does not go back to operator new. An optional
+// caller-provided buffer is used before the first block. The most recent
+// allocation can be grown in place with try_expand. Also usable as a
+// std::pmr::memory_resource.
+class arena : public std::pmr::memory_resource {
+ public:
+  static constexpr std::size_t default_block_size = 64 * 1024;
+
+  explicit arena(std::size_t block_size = default_block_size) noexcept;
+  arena(void *buffer, std::size_t size,
+        std::size_t block_size = default_block_size) noexcept;
+  arena(const arena &) = delete;
+  arena &operator=(const arena &) = delete;
+  ~arena() override;
+
+  void *allocate(std::size_t bytes,
+                 std::size_t alignment = alignof(std::max_align_t));
+  void deallocate(void *p, std::size_t bytes,
+                  std::size_t alignment = alignof(std::max_align_t)) noexcept;
+  bool try_expand(void *p, std::size_t old_bytes,
+                  std::size_t new_bytes) noexcept;
+  void release() noexcept;
+  std::size_t bytes_reserved() const noexcept;
+
+ private:
+  struct block_header {
+    block_header *next;
+    std::size_t size;
+  };
+
+  void *allocate_from_new_block(std::size_t bytes, std::size_t alignment);
+  static void free_blocks(block_header *blocks) noexcept;
+  static char *align_up(char *p, std::size_t alignment) noexcept;
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override;
+
+  char *_initial_buffer;
+  std::size_t _initial_size;
+  std::size_t _block_size;
+  std::size_t _next_block_size;
+  std::size_t _bytes_reserved;
+  block_header *_blocks;
+  block_header *_spare;
+  char *_cursor;
+  char *_end;
+};
+
+// Allocator handing out memory from an arena. Containers keep the arena they
+// were created with: the allocator does not propagate on copy, move or swap,
+// and two allocators compare equal only when they share an arena.
+template <class T>
+class arena_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  template <class U>
+  struct rebind {
+    using other = arena_allocator<U>;
+  };
+
+  arena_allocator(arena &resource) noexcept;
+  template <class U>
+  arena_allocator(const arena_allocator<U> &other) noexcept;
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n) noexcept;
+  bool try_expand(T *p, size_type old_n, size_type new_n) noexcept;
+  size_type max_size() const noexcept;
+  arena *resource() const noexcept;
+
+  template <class U>
+  bool operator==(const arena_allocator<U> &other) const noexcept;
+  template <class U>
+  bool operator!=(const arena_allocator<U> &other) const noexcept;
+
+ private:
+  arena *_arena;
+};
+
+inline arena::arena(std::size_t block_size) noexcept
+    : arena(nullptr, 0, block_size) {}
+
+inline arena::arena(void *buffer, std::size_t size,
+                    std::size_t block_size) noexcept
+    : _initial_buffer(static_cast<char *>(buffer)),
+      _initial_size(size),
+      _block_size(block_size < 2 * sizeof(block_header)
+                      ? 2 * sizeof(block_header)
+                      : block_size),
+      _next_block_size(_block_size),
+      _bytes_reserved(0),
+      _blocks(nullptr),
+      _spare(nullptr),
+      _cursor(_initial_buffer),
+      _end(_initial_buffer + size) {}
+
+inline arena::~arena() {
+  free_blocks(_blocks);
+  free_blocks(_spare);
+}
+
+inline void *arena::allocate(std::size_t bytes, std::size_t alignment) {
+  if (_cursor != nullptr) {
+    char *result = align_up(_cursor, alignment);
+    if (result <= _end && static_cast<std::size_t>(_end - result) >= bytes) {
+      _cursor = result + bytes;
+      return result;
+    }
+  }
+  return allocate_from_new_block(bytes, alignment);
+}
+
+inline void arena::deallocate(void *, std::size_t, std::size_t) noexcept {}
+
+inline bool arena::try_expand(void *p, std::size_t old_bytes,
+                              std::size_t new_bytes) noexcept {
+  if (new_bytes <= old_bytes) return true;
+  char *block_end = static_cast<char *>(p) + old_bytes;
+  if (block_end != _cursor) return false;
+  if (static_cast<std::size_t>(_end - _cursor) < new_bytes - old_bytes)
+    return false;
+  _cursor += new_bytes - old_bytes;
+  return true;
+}
+
+inline void arena::release() noexcept {
+  if (_blocks != nullptr) {
+    free_blocks(_spare);
+    _spare = _blocks;
+    free_blocks(_spare->next);
+    _spare->next = nullptr;
+    _blocks = nullptr;
+    _bytes_reserved = _spare->size;
+  }
+  _next_block_size = _block_size;
+  _cursor = _initial_buffer;
+  _end = _initial_buffer + _initial_size;
+}
+
+inline std::size_t arena::bytes_reserved() const noexcept {
+  return _bytes_reserved;
+}
+
+inline void *arena::allocate_from_new_block(std::size_t bytes,
+                                            std::size_t alignment) {
+  std::size_t header = sizeof(block_header);
+  if (bytes > SIZE_MAX - header - alignment) throw std::bad_alloc();
+  block_header *new_block = nullptr;
+  if (_spare != nullptr && _spare->size >= header + alignment + bytes) {
+    new_block = _spare;
+    _spare = nullptr;
+  } else {
+    std::size_t size = _next_block_size;
+    if (size < header + alignment + bytes) size = header + alignment + bytes;
+    new_block = static_cast<block_header *>(::operator new(size));
+    new_block->size = size;
+    _bytes_reserved += size;
+    if (_next_block_size <= SIZE_MAX / 2) _next_block_size *= 2;
+  }
+  new_block->next = _blocks;
+  _blocks = new_block;
+  std::size_t size = new_block->size;
+  char *begin = reinterpret_cast<char *>(new_block) + header;
+  char *result = align_up(begin, alignment);
+  _cursor = result + bytes;
+  _end = reinterpret_cast<char *>(new_block) + size;
+  return result;
+}
+
+inline void arena::free_blocks(block_header *blocks) noexcept {
+  while (blocks != nullptr) {
+    block_header *next = blocks->next;
+    ::operator delete(static_cast<void *>(blocks));
+    blocks = next;
+  }
+}
+
+inline char *arena::align_up(char *p, std::size_t alignment) noexcept {
+  std::uintptr_t value = reinterpret_cast<std::uintptr_t>(p);
+  std::uintptr_t aligned = (value + alignment - 1) & ~(alignment - 1);
+  return p + (aligned - value);
+}
+
+inline void *arena::do_allocate(std::size_t bytes, std::size_t alignment) {
+  return allocate(bytes, alignment);
+}
+
+inline void arena::do_deallocate(void *, std::size_t, std::size_t) {}
+
+inline bool arena::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+template <class T>
+arena_allocator<T>::arena_allocator(arena &resource) noexcept
+    : _arena(&resource) {}
+
+template <class T>
+template <class U>
+arena_allocator<T>::arena_allocator(const arena_allocator<U> &other) noexcept
+    : _arena(other.resource()) {}
+
+template <class T>
+T *arena_allocator<T>::allocate(size_type n) {
+  if (n > max_size()) throw std::bad_array_new_length();
+  return static_cast<T *>(_arena->allocate(n * sizeof(T), alignof(T)));
+}
+
+template <class T>
+void arena_allocator<T>::deallocate(T *, size_type) noexcept {}
+
+template <class T>
+bool arena_allocator<T>::try_expand(T *p, size_type old_n,
+                                    size_type new_n) noexcept {
+  if (new_n > max_size()) return false;
+  return _arena->try_expand(p, old_n * sizeof(T), new_n * sizeof(T));
+}
+
+template <class T>
+typename arena_allocator<T>::size_type arena_allocator<T>::max_size()
+    const noexcept {
+  return PTRDIFF_MAX / sizeof(T);
+}
+
+template <class T>
+arena *arena_allocator<T>::resource() const noexcept {
+  return _arena;
+}
+
+template <class T>
+template <class U>
+bool arena_allocator<T>::operator==(
+    const arena_allocator<U> &other) const noexcept {
+  return _arena == other.resource();
+}
+
+template <class T>
+template <class U>
+bool arena_allocator<T>::operator!=(
+    const arena_allocator<U> &other) const noexcept {
+  return _arena != other.resource();
+}
+
+}  // namespace s21
+
+#endif  // S21_ARENA_H_
@@ -2,6 +2,10 @@
 #define S21_ARRAY_H_
 
 #include <iostream>
+#include <tuple>
+#include <utility>
+
+#include "s21_memory.h"
 
 namespace s21 {
 
@@ -19,181 +23,383 @@ struct array {
   using reverse_iterator = std::reverse_iterator<iterator>;
   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-  reference at(size_type pos);
-  const_reference at(size_type pos) const;
-  reference operator[](size_type pos);
-  const_reference operator[](size_type pos) const;
-  reference front();
-  const_reference front() const;
-  reference back();
-  const_reference back() const;
-  T *data() noexcept;
-  const T *data() const noexcept;
-
-  iterator begin() noexcept;
-  const_iterator begin() const noexcept;
-  const_iterator cbegin() const noexcept;
-  iterator end() noexcept;
-  const_iterator end() const noexcept;
-  const_iterator cend() const noexcept;
-  reverse_iterator rbegin() noexcept;
-  const_reverse_iterator rbegin() const noexcept;
-  const_reverse_iterator crbegin() const noexcept;
-  reverse_iterator rend() noexcept;
-  const_reverse_iterator rend() const noexcept;
-  const_reverse_iterator crend() const noexcept;
-
-  bool empty() const noexcept;
-  size_type size() const noexcept;
-  size_type max_size() const noexcept;
-
-  void fill(const T &other);
-  void swap(array &other) noexcept(std::is_nothrow_swappable_v<T>);
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos);
+  constexpr const_reference operator[](size_type pos) const;
+  constexpr reference front();
+  constexpr const_reference front() const;
+  constexpr reference back();
+  constexpr const_reference back() const;
+  constexpr T *data() noexcept;
+  constexpr const T *data() const noexcept;
+
+  constexpr iterator begin() noexcept;
+  constexpr const_iterator begin() const noexcept;
+  constexpr const_iterator cbegin() const noexcept;
+  constexpr iterator end() noexcept;
+  constexpr const_iterator end() const noexcept;
+  constexpr const_iterator cend() const noexcept;
+  constexpr reverse_iterator rbegin() noexcept;
+  constexpr const_reverse_iterator rbegin() const noexcept;
+  constexpr const_reverse_iterator crbegin() const noexcept;
+  constexpr reverse_iterator rend() noexcept;
+  constexpr const_reverse_iterator rend() const noexcept;
+  constexpr const_reverse_iterator crend() const noexcept;
+
+  constexpr bool empty() const noexcept;
+  constexpr size_type size() const noexcept;
+  constexpr size_type max_size() const noexcept;
+
+  constexpr void fill(const T &other);
+  constexpr void swap(array &other) noexcept(std::is_nothrow_swappable_v<T>);
 
   T _array[N ? N : 1];
 };
 
+// array whose storage starts on an Align-byte boundary. data() and begin()
+// carry the alignment as a hint to the vectorizer.
+template <class T, std::size_t N, std::size_t Align = 64>
+struct alignas(Align) aligned_array : array<T, N> {
+  static_assert(Align != 0 && (Align & (Align - 1)) == 0,
+                "alignment must be a power of two");
+  static_assert(Align >= alignof(T),
+                "alignment must not be weaker than the alignment of T");
+
+  using iterator = typename array<T, N>::iterator;
+  using const_iterator = typename array<T, N>::const_iterator;
+
+  static constexpr std::size_t alignment = Align;
+
+  constexpr T *data() noexcept;
+  constexpr const T *data() const noexcept;
+  constexpr iterator begin() noexcept;
+  constexpr const_iterator begin() const noexcept;
+  constexpr const_iterator cbegin() const noexcept;
+};
+
+template <std::size_t I, class T, std::size_t N>
+constexpr T &get(array<T, N> &arr) noexcept;
+template <std::size_t I, class T, std::size_t N>
+constexpr const T &get(const array<T, N> &arr) noexcept;
+template <std::size_t I, class T, std::size_t N>
+constexpr T &&get(array<T, N> &&arr) noexcept;
+template <std::size_t I, class T, std::size_t N>
+constexpr const T &&get(const array<T, N> &&arr) noexcept;
+
+template <class T, std::size_t N>
+constexpr bool operator==(const array<T, N> &lhs, const array<T, N> &rhs);
 template <class T, std::size_t N>
-typename array<T, N>::reference array<T, N>::at(size_type pos) {
+constexpr bool operator!=(const array<T, N> &lhs, const array<T, N> &rhs);
+template <class T, std::size_t N>
+constexpr bool operator<(const array<T, N> &lhs, const array<T, N> &rhs);
+template <class T, std::size_t N>
+constexpr bool operator>(const array<T, N> &lhs, const array<T, N> &rhs);
+template <class T, std::size_t N>
+constexpr bool operator<=(const array<T, N> &lhs, const array<T, N> &rhs);
+template <class T, std::size_t N>
+constexpr bool operator>=(const array<T, N> &lhs, const array<T, N> &rhs);
+
+template <class T, std::size_t N>
+constexpr void swap(array<T, N> &lhs,
+                    array<T, N> &rhs) noexcept(noexcept(lhs.swap(rhs)));
+
+template <class T, std::size_t N>
+constexpr array<std::remove_cv_t<T>, N> to_array(T (&arr)[N]);
+template <class T, std::size_t N>
+constexpr array<std::remove_cv_t<T>, N> to_array(T (&&arr)[N]);
+
+template <class T, std::size_t N>
+constexpr typename array<T, N>::reference array<T, N>::at(size_type pos) {
   if (pos >= N) throw std::out_of_range("Index out of range");
   return _array[pos];
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_reference array<T, N>::at(size_type pos) const {
+constexpr typename array<T, N>::const_reference array<T, N>::at(
+    size_type pos) const {
   if (pos >= N) throw std::out_of_range("Index out of range");
   return _array[pos];
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::reference array<T, N>::operator[](size_type pos) {
+constexpr typename array<T, N>::reference array<T, N>::operator[](
+    size_type pos) {
   return _array[pos];
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_reference array<T, N>::operator[](
+constexpr typename array<T, N>::const_reference array<T, N>::operator[](
     size_type pos) const {
   return _array[pos];
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::reference array<T, N>::front() {
+constexpr typename array<T, N>::reference array<T, N>::front() {
   return *begin();
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_reference array<T, N>::front() const {
+constexpr typename array<T, N>::const_reference array<T, N>::front() const {
   return *cbegin();
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::reference array<T, N>::back() {
+constexpr typename array<T, N>::reference array<T, N>::back() {
   return *(end() - 1);
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_reference array<T, N>::back() const {
+constexpr typename array<T, N>::const_reference array<T, N>::back() const {
   return *(cend() - 1);
 }
 
 template <class T, std::size_t N>
-T *array<T, N>::data() noexcept {
+constexpr T *array<T, N>::data() noexcept {
   return std::addressof(_array[0]);
 }
 
 template <class T, std::size_t N>
-const T *array<T, N>::data() const noexcept {
+constexpr const T *array<T, N>::data() const noexcept {
   return std::addressof(_array[0]);
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::iterator array<T, N>::begin() noexcept {
+constexpr typename array<T, N>::iterator array<T, N>::begin() noexcept {
   return iterator(std::addressof(_array[0]));
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_iterator array<T, N>::begin() const noexcept {
+constexpr typename array<T, N>::const_iterator array<T, N>::begin()
+    const noexcept {
   return const_iterator(std::addressof(_array[0]));
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_iterator array<T, N>::cbegin() const noexcept {
+constexpr typename array<T, N>::const_iterator array<T, N>::cbegin()
+    const noexcept {
   return const_iterator(std::addressof(_array[0]));
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::iterator array<T, N>::end() noexcept {
+constexpr typename array<T, N>::iterator array<T, N>::end() noexcept {
   return iterator(std::addressof(_array[N]));
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_iterator array<T, N>::end() const noexcept {
+constexpr typename array<T, N>::const_iterator array<T, N>::end()
+    const noexcept {
   return const_iterator(std::addressof(_array[N]));
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_iterator array<T, N>::cend() const noexcept {
+constexpr typename array<T, N>::const_iterator array<T, N>::cend()
+    const noexcept {
   return const_iterator(std::addressof(_array[N]));
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::reverse_iterator array<T, N>::rbegin() noexcept {
+constexpr typename array<T, N>::reverse_iterator
+array<T, N>::rbegin() noexcept {
   return reverse_iterator(end());
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_reverse_iterator array<T, N>::rbegin()
+constexpr typename array<T, N>::const_reverse_iterator array<T, N>::rbegin()
     const noexcept {
   return const_reverse_iterator(cend());
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_reverse_iterator array<T, N>::crbegin()
+constexpr typename array<T, N>::const_reverse_iterator array<T, N>::crbegin()
     const noexcept {
   return const_reverse_iterator(cend());
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::reverse_iterator array<T, N>::rend() noexcept {
+constexpr typename array<T, N>::reverse_iterator array<T, N>::rend() noexcept {
   return reverse_iterator(begin());
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_reverse_iterator array<T, N>::rend()
+constexpr typename array<T, N>::const_reverse_iterator array<T, N>::rend()
     const noexcept {
   return const_reverse_iterator(cbegin());
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::const_reverse_iterator array<T, N>::crend()
+constexpr typename array<T, N>::const_reverse_iterator array<T, N>::crend()
     const noexcept {
   return const_reverse_iterator(cbegin());
 }
 
 template <class T, std::size_t N>
-bool array<T, N>::empty() const noexcept {
+constexpr bool array<T, N>::empty() const noexcept {
   return N == 0;
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::size_type array<T, N>::size() const noexcept {
+constexpr typename array<T, N>::size_type array<T, N>::size() const noexcept {
   return N;
 }
 
 template <class T, std::size_t N>
-typename array<T, N>::size_type array<T, N>::max_size() const noexcept {
+constexpr typename array<T, N>::size_type array<T, N>::max_size()
+    const noexcept {
   return N;
 }
 
 template <class T, std::size_t N>
-void array<T, N>::fill(const T &other) {
-  std::fill_n(begin(), N, other);
+constexpr void array<T, N>::fill(const T &other) {
+  for (size_type i = 0; i != N; ++i) _array[i] = other;
+}
+
+// std::swap is only constexpr from C++20, so constant evaluation swaps by
+// moves; at run time the element type's own swap is found by ADL. Compilers
+// that cannot tell the two apart always swap by moves.
+template <class T, std::size_t N>
+constexpr void array<T, N>::swap(array &other) noexcept(
+    std::is_nothrow_swappable_v<T>) {
+  for (size_type i = 0; i != N; ++i) {
+#if defined(__GNUC__)
+    if (!__builtin_is_constant_evaluated()) {
+      using std::swap;
+      swap(_array[i], other._array[i]);
+      continue;
+    }
+#endif
+    T value(std::move(_array[i]));
+    _array[i] = std::move(other._array[i]);
+    other._array[i] = std::move(value);
+  }
+}
+
+template <class T, std::size_t N, std::size_t Align>
+constexpr T *aligned_array<T, N, Align>::data() noexcept {
+  return assume_aligned<Align>(array<T, N>::data());
+}
+
+template <class T, std::size_t N, std::size_t Align>
+constexpr const T *aligned_array<T, N, Align>::data() const noexcept {
+  return assume_aligned<Align>(array<T, N>::data());
+}
+
+template <class T, std::size_t N, std::size_t Align>
+constexpr typename aligned_array<T, N, Align>::iterator
+aligned_array<T, N, Align>::begin() noexcept {
+  return data();
+}
+
+template <class T, std::size_t N, std::size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_iterator
+aligned_array<T, N, Align>::begin() const noexcept {
+  return data();
+}
+
+template <class T, std::size_t N, std::size_t Align>
+constexpr typename aligned_array<T, N, Align>::const_iterator
+aligned_array<T, N, Align>::cbegin() const noexcept {
+  return data();
+}
+
+template <std::size_t I, class T, std::size_t N>
+constexpr T &get(array<T, N> &arr) noexcept {
+  static_assert(I < N, "array index out of range");
+  return arr._array[I];
+}
+
+template <std::size_t I, class T, std::size_t N>
+constexpr const T &get(const array<T, N> &arr) noexcept {
+  static_assert(I < N, "array index out of range");
+  return arr._array[I];
+}
+
+template <std::size_t I, class T, std::size_t N>
+constexpr T &&get(array<T, N> &&arr) noexcept {
+  static_assert(I < N, "array index out of range");
+  return std::move(arr._array[I]);
+}
+
+template <std::size_t I, class T, std::size_t N>
+constexpr const T &&get(const array<T, N> &&arr) noexcept {
+  static_assert(I < N, "array index out of range");
+  return std::move(arr._array[I]);
+}
+
+template <class T, std::size_t N>
+constexpr bool operator==(const array<T, N> &lhs, const array<T, N> &rhs) {
+  for (std::size_t i = 0; i != N; ++i)
+    if (!(lhs[i] == rhs[i])) return false;
+  return true;
+}
+
+template <class T, std::size_t N>
+constexpr bool operator!=(const array<T, N> &lhs, const array<T, N> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <class T, std::size_t N>
+constexpr bool operator<(const array<T, N> &lhs, const array<T, N> &rhs) {
+  for (std::size_t i = 0; i != N; ++i) {
+    if (lhs[i] < rhs[i]) return true;
+    if (rhs[i] < lhs[i]) return false;
+  }
+  return false;
+}
+
+template <class T, std::size_t N>
+constexpr bool operator>(const array<T, N> &lhs, const array<T, N> &rhs) {
+  return rhs < lhs;
+}
+
+template <class T, std::size_t N>
+constexpr bool operator<=(const array<T, N> &lhs, const array<T, N> &rhs) {
+  return !(rhs < lhs);
 }
 
 template <class T, std::size_t N>
-void array<T, N>::swap(array &other) noexcept(std::is_nothrow_swappable_v<T>) {
-  std::swap_ranges(begin(), end(), other.begin());
+constexpr bool operator>=(const array<T, N> &lhs, const array<T, N> &rhs) {
+  return !(lhs < rhs);
+}
+
+template <class T, std::size_t N>
+constexpr void swap(array<T, N> &lhs,
+                    array<T, N> &rhs) noexcept(noexcept(lhs.swap(rhs))) {
+  lhs.swap(rhs);
+}
+
+template <class T, std::size_t N, std::size_t... I>
+constexpr array<std::remove_cv_t<T>, N> to_array_impl(
+    T (&arr)[N], std::index_sequence<I...>) {
+  return {{arr[I]...}};
+}
+
+template <class T, std::size_t N, std::size_t... I>
+constexpr array<std::remove_cv_t<T>, N> to_array_impl(
+    T (&&arr)[N], std::index_sequence<I...>) {
+  return {{std::move(arr[I])...}};
 }
+
+template <class T, std::size_t N>
+constexpr array<std::remove_cv_t<T>, N> to_array(T (&arr)[N]) {
+  return to_array_impl(arr, std::make_index_sequence<N>());
+}
+
+template <class T, std::size_t N>
+constexpr array<std::remove_cv_t<T>, N> to_array(T (&&arr)[N]) {
+  return to_array_impl(std::move(arr), std::make_index_sequence<N>());
+}
+
 }  // namespace s21
 
+template <class T, std::size_t N>
+struct std::tuple_size<s21::array<T, N>>
+    : std::integral_constant<std::size_t, N> {};
+
+template <std::size_t I, class T, std::size_t N>
+struct std::tuple_element<I, s21::array<T, N>> {
+  static_assert(I < N, "array index out of range");
+  using type = T;
+};
+
 #endif  // S21_ARRAY_H_
@@ -0,0 +1,290 @@
+#ifndef S21_BINARY_IO_H_
+#define S21_BINARY_IO_H_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__unix__)
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "s21_array.h"
+#include "s21_span.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Versioned binary image of a contiguous range of trivially copyable values:
+// a fixed header followed by zero padding up to alignof(T) and the raw
+// element bytes. Images are native-endian; a byte-swapped magic is rejected.
+struct binary_header {
+  std::uint32_t magic;
+  std::uint16_t version;
+  std::uint16_t data_offset;
+  std::uint32_t type_size;
+  std::uint32_t type_align;
+  std::uint64_t count;
+  std::uint64_t checksum;
+};
+
+static_assert(sizeof(binary_header) == 32, "binary_header must be packed");
+
+inline constexpr std::uint32_t binary_magic = 0x56313253;  // "S21V"
+inline constexpr std::uint16_t binary_version = 1;
+inline constexpr std::size_t binary_max_alignment = 256;
+inline constexpr std::size_t binary_read_chunk = std::size_t(1) << 20;
+
+template <class T>
+constexpr std::size_t binary_data_offset() noexcept {
+  return (sizeof(binary_header) + alignof(T) - 1) / alignof(T) * alignof(T);
+}
+
+template <class T>
+constexpr std::size_t binary_image_size(std::size_t count) noexcept {
+  return binary_data_offset<T>() + count * sizeof(T);
+}
+
+std::uint64_t binary_checksum(const void *data, std::size_t bytes) noexcept;
+
+template <class T>
+binary_header make_binary_header(const T *data, std::size_t count) noexcept;
+template <class T>
+std::size_t check_binary_header(const binary_header &header);
+
+template <class T>
+span<const T> view_binary(const void *buffer, std::size_t bytes,
+                          bool verify_checksum = true);
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void write_binary(int fd,
+                  const vector<T, Allocator, GrowthPolicy, StatsPolicy> &vec);
+template <class T, std::size_t N>
+void write_binary(int fd, const array<T, N> &arr);
+template <class T>
+void write_binary(int fd, const T *data, std::size_t count);
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void read_binary(int fd, vector<T, Allocator, GrowthPolicy, StatsPolicy> &vec);
+template <class T, std::size_t N>
+void read_binary(int fd, array<T, N> &arr);
+
+void read_binary_exact(int fd, void *data, std::size_t bytes);
+binary_header read_binary_header(int fd);
+void read_binary_payload(int fd, void *data, std::size_t bytes,
+                         std::size_t padding, std::uint64_t checksum);
+
+// Four independent multiply-xor lanes over 8-byte words, so the checksum runs
+// close to memory bandwidth instead of being bound by one dependency chain.
+inline std::uint64_t binary_checksum(const void *data,
+                                     std::size_t bytes) noexcept {
+  constexpr std::uint64_t prime = 0x100000001b3ULL;
+  const unsigned char *bytes_ptr = static_cast<const unsigned char *>(data);
+  std::uint64_t lanes[4] = {0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL,
+                            0x9e3779b97f4a7c15ULL, 0xc2b2ae3d27d4eb4fULL};
+  std::size_t pos = 0;
+  for (; pos + 32 <= bytes; pos += 32) {
+    for (int lane = 0; lane < 4; ++lane) {
+      std::uint64_t word;
+      std::memcpy(&word, bytes_ptr + pos + lane * 8, sizeof(word));
+      lanes[lane] = (lanes[lane] ^ word) * prime;
+    }
+  }
+  std::uint64_t hash = bytes;
+  for (std::uint64_t lane : lanes) hash = (hash ^ lane) * prime;
+  for (; pos < bytes; ++pos) hash = (hash ^ bytes_ptr[pos]) * prime;
+  return hash ^ (hash >> 32);
+}
+
+template <class T>
+binary_header make_binary_header(const T *data, std::size_t count) noexcept {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "binary images hold raw bytes of trivially copyable types");
+  static_assert(alignof(T) <= binary_max_alignment, "Alignment too large");
+  binary_header header{};
+  header.magic = binary_magic;
+  header.version = binary_version;
+  header.data_offset = static_cast<std::uint16_t>(binary_data_offset<T>());
+  header.type_size = sizeof(T);
+  header.type_align = alignof(T);
+  header.count = count;
+  header.checksum = binary_checksum(data, count * sizeof(T));
+  return header;
+}
+
+// Returns the element count after checking that the image was written for a
+// type with the same size and alignment as T.
+template <class T>
+std::size_t check_binary_header(const binary_header &header) {
+  if (header.magic != binary_magic)
+    throw std::runtime_error("binary image: bad magic");
+  if (header.version != binary_version)
+    throw std::runtime_error("binary image: unsupported version");
+  if (header.type_size != sizeof(T) || header.type_align != alignof(T) ||
+      header.data_offset != binary_data_offset<T>())
+    throw std::runtime_error("binary image: element type mismatch");
+  if (header.count > SIZE_MAX / sizeof(T))
+    throw std::runtime_error("binary image: element count too large");
+  return static_cast<std::size_t>(header.count);
+}
+
+// Validates an image that is already in memory, e.g. a mapped file, and
+// returns a view of its elements without copying them.
+template <class T>
+span<const T> view_binary(const void *buffer, std::size_t bytes,
+                          bool verify_checksum) {
+  if (bytes < sizeof(binary_header))
+    throw std::runtime_error("binary image: truncated header");
+  binary_header header;
+  std::memcpy(&header, buffer, sizeof(header));
+  std::size_t count = check_binary_header<T>(header);
+  if (bytes < binary_data_offset<T>() ||
+      count > (bytes - binary_data_offset<T>()) / sizeof(T))
+    throw std::runtime_error("binary image: truncated data");
+  const unsigned char *payload =
+      static_cast<const unsigned char *>(buffer) + binary_data_offset<T>();
+  if (reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0)
+    throw std::runtime_error("binary image: misaligned buffer");
+  if (verify_checksum &&
+      binary_checksum(payload, count * sizeof(T)) != header.checksum)
+    throw std::runtime_error("binary image: checksum mismatch");
+  return span<const T>(reinterpret_cast<const T *>(payload), count);
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void write_binary(int fd,
+                  const vector<T, Allocator, GrowthPolicy, StatsPolicy> &vec) {
+  write_binary(fd, vec.data(), vec.size());
+}
+
+template <class T, std::size_t N>
+void write_binary(int fd, const array<T, N> &arr) {
+  write_binary(fd, arr.data(), arr.size());
+}
+
+// Header, padding and elements go out in one writev; the loop only runs
+// again for short writes to pipes and sockets.
+template <class T>
+void write_binary(int fd, const T *data, std::size_t count) {
+  binary_header header = make_binary_header(data, count);
+#if defined(__unix__)
+  static const unsigned char padding[binary_max_alignment] = {};
+  iovec parts[3] = {
+      {&header, sizeof(header)},
+      {const_cast<unsigned char *>(padding),
+       binary_data_offset<T>() - sizeof(header)},
+      {const_cast<T *>(data), count * sizeof(T)}};
+  iovec *part = parts;
+  int remaining = 3;
+  while (remaining > 0) {
+    ssize_t written = ::writev(fd, part, remaining);
+    if (written == -1) {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "writev");
+    }
+    std::size_t done = static_cast<std::size_t>(written);
+    while (remaining > 0 && done >= part->iov_len) {
+      done -= part->iov_len;
+      ++part;
+      --remaining;
+    }
+    if (remaining > 0) {
+      part->iov_base = static_cast<char *>(part->iov_base) + done;
+      part->iov_len -= done;
+    }
+  }
+#else
+  (void)fd;
+  (void)header;
+  throw std::runtime_error("binary I/O is not supported on this platform");
+#endif
+}
+
+// Reads straight into the vector's buffer. Elements are not initialized
+// before the read, so only the image bytes are ever written to them. The
+// count in the header is not trusted for the allocation: the capacity
+// doubles as data arrives, starting from one binary_read_chunk, so it stays
+// within twice the bytes actually read and a corrupt or truncated stream
+// fails on EOF instead of allocating its claimed size. Provides the basic
+// exception guarantee: on error the vector is left empty.
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void read_binary(int fd, vector<T, Allocator, GrowthPolicy, StatsPolicy> &vec) {
+  constexpr std::size_t chunk =
+      sizeof(T) < binary_read_chunk ? binary_read_chunk / sizeof(T) : 1;
+  binary_header header = read_binary_header(fd);
+  std::size_t count = check_binary_header<T>(header);
+  vec.clear();
+  try {
+    unsigned char skipped[binary_max_alignment];
+    read_binary_exact(fd, skipped, binary_data_offset<T>() - sizeof(header));
+    while (vec.size() < count) {
+      std::size_t done = vec.size();
+      std::size_t next = std::min(count - done, chunk);
+      if (done + next > vec.capacity())
+        vec.reserve(std::min(count, std::max(done + next, 2 * vec.capacity())));
+      vec.resize_for_overwrite(done + next);
+      read_binary_exact(fd, vec.data() + done, next * sizeof(T));
+    }
+    if (binary_checksum(vec.data(), count * sizeof(T)) != header.checksum)
+      throw std::runtime_error("binary image: checksum mismatch");
+  } catch (...) {
+    vec.clear();
+    throw;
+  }
+}
+
+template <class T, std::size_t N>
+void read_binary(int fd, array<T, N> &arr) {
+  binary_header header = read_binary_header(fd);
+  if (check_binary_header<T>(header) != N)
+    throw std::runtime_error("binary image: element count mismatch");
+  read_binary_payload(fd, arr.data(), N * sizeof(T),
+                      binary_data_offset<T>() - sizeof(header),
+                      header.checksum);
+}
+
+inline void read_binary_exact(int fd, void *data, std::size_t bytes) {
+#if defined(__unix__)
+  char *pos = static_cast<char *>(data);
+  while (bytes > 0) {
+    ssize_t got = ::read(fd, pos, bytes);
+    if (got == -1) {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "read");
+    }
+    if (got == 0) throw std::runtime_error("binary image: unexpected EOF");
+    pos += got;
+    bytes -= static_cast<std::size_t>(got);
+  }
+#else
+  (void)fd;
+  (void)data;
+  (void)bytes;
+  throw std::runtime_error("binary I/O is not supported on this platform");
+#endif
+}
+
+inline binary_header read_binary_header(int fd) {
+  binary_header header;
+  read_binary_exact(fd, &header, sizeof(header));
+  return header;
+}
+
+inline void read_binary_payload(int fd, void *data, std::size_t bytes,
+                                std::size_t padding, std::uint64_t checksum) {
+  unsigned char skipped[binary_max_alignment];
+  read_binary_exact(fd, skipped, padding);
+  read_binary_exact(fd, data, bytes);
+  if (binary_checksum(data, bytes) != checksum)
+    throw std::runtime_error("binary image: checksum mismatch");
+}
+
+}  // namespace s21
+
+#endif  // S21_BINARY_IO_H_
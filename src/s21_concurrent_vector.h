@@ -0,0 +1,581 @@
+#ifndef S21_CONCURRENT_VECTOR_H_
+#define S21_CONCURRENT_VECTOR_H_
+
+#include <atomic>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Append-only vector that many threads can push_back into at once. Storage
+// is a table of segments that double in size (8, 16, 32, ...), allocated on
+// first use, so elements never move once constructed. push_back claims a
+// slot with a compare-and-swap and is lock-free; size() counts only the
+// prefix of slots whose elements are fully constructed, so indexing and
+// iterating below size() is safe while other threads keep appending.
+//
+// Values are built and the slot's segment allocated before the slot is
+// claimed, so neither a throwing constructor nor a failed allocation leaves
+// a hole that would stop size() short.
+template <class T, class Allocator = std::allocator<T>>
+class concurrent_vector {
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "concurrent_vector moves values into claimed slots");
+
+  struct slot {
+    std::atomic<bool> ready{false};
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using slot_allocator = typename alloc_traits::template rebind_alloc<slot>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+  template <bool IsConst>
+  class index_iterator {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using reference = std::conditional_t<IsConst, const T &, T &>;
+    using pointer = std::conditional_t<IsConst, const T *, T *>;
+    using iterator_category = std::random_access_iterator_tag;
+    using container_type = std::conditional_t<IsConst, const concurrent_vector,
+                                              concurrent_vector>;
+
+    template <bool IsConstFriend>
+    friend class index_iterator;
+
+    index_iterator(container_type *vec, std::size_t pos) noexcept;
+    index_iterator() noexcept;
+
+    operator index_iterator<true>() const noexcept;
+
+    reference operator*() const;
+    pointer operator->() const;
+    reference operator[](difference_type n) const;
+
+    index_iterator &operator++();
+    index_iterator &operator--();
+    index_iterator operator++(int);
+    index_iterator operator--(int);
+    index_iterator operator+(difference_type n) const;
+    index_iterator operator-(difference_type n) const;
+    index_iterator &operator+=(difference_type n);
+    index_iterator &operator-=(difference_type n);
+    difference_type operator-(const index_iterator<true> &other) const;
+
+    bool operator==(const index_iterator<true> &other) const noexcept;
+    bool operator!=(const index_iterator<true> &other) const noexcept;
+    bool operator<(const index_iterator<true> &other) const noexcept;
+
+   private:
+    container_type *_vec;
+    std::size_t _pos;
+  };
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
+  using iterator = index_iterator<false>;
+  using const_iterator = index_iterator<true>;
+
+  static constexpr size_type first_segment_bits = 3;
+  static constexpr size_type first_segment_size = size_type(1)
+                                                  << first_segment_bits;
+  static constexpr size_type segment_count = 64 - first_segment_bits;
+
+  concurrent_vector() noexcept(noexcept(Allocator()));
+  explicit concurrent_vector(const Allocator &alloc) noexcept;
+  concurrent_vector(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(const concurrent_vector &) = delete;
+  ~concurrent_vector();
+
+  allocator_type get_allocator() const noexcept;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept;
+
+  // Not safe to call while other threads access the vector.
+  void clear() noexcept;
+
+  iterator push_back(const T &value);
+  iterator push_back(T &&value);
+  template <class... Args>
+  iterator emplace_back(Args &&...args);
+
+ private:
+  static size_type segment_of(size_type index) noexcept;
+  static size_type segment_begin(size_type segment) noexcept;
+  static size_type segment_size(size_type segment) noexcept;
+  static T *element(slot &item) noexcept;
+
+  slot *ensure_segment(size_type segment);
+  slot *find_slot(size_type index) const noexcept;
+  void publish() noexcept;
+
+  Allocator _alloc;
+  // Separate cache lines: every append writes _reserved and _size, readers
+  // only load _size and the segment table.
+  alignas(64) std::atomic<size_type> _reserved;
+  alignas(64) std::atomic<size_type> _size;
+  alignas(64) std::atomic<slot *> _segments[segment_count];
+};
+
+template <class T, class Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector() noexcept(
+    noexcept(Allocator()))
+    : concurrent_vector(Allocator()) {}
+
+template <class T, class Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(
+    const Allocator &alloc) noexcept
+    : _alloc(alloc), _reserved(0), _size(0) {
+  for (std::atomic<slot *> &segment : _segments) segment.store(nullptr);
+}
+
+template <class T, class Allocator>
+concurrent_vector<T, Allocator>::~concurrent_vector() {
+  clear();
+  slot_allocator slot_alloc(_alloc);
+  for (size_type segment = 0; segment < segment_count; ++segment) {
+    slot *items = _segments[segment].load(std::memory_order_relaxed);
+    if (items == nullptr) continue;
+    for (size_type i = 0; i < segment_size(segment); ++i)
+      slot_traits::destroy(slot_alloc, items + i);
+    slot_traits::deallocate(slot_alloc, items, segment_size(segment));
+  }
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::allocator_type
+concurrent_vector<T, Allocator>::get_allocator() const noexcept {
+  return _alloc;
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::at(size_type pos) {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::at(size_type pos) const {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::operator[](size_type pos) {
+  return *element(*find_slot(pos));
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::operator[](size_type pos) const {
+  return *element(*find_slot(pos));
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::front() {
+  return (*this)[0];
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::front() const {
+  return (*this)[0];
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::back() {
+  return (*this)[size() - 1];
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::back() const {
+  return (*this)[size() - 1];
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::begin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::cbegin() const noexcept {
+  return begin();
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::end() noexcept {
+  return iterator(this, size());
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::end() const noexcept {
+  return const_iterator(this, size());
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::cend() const noexcept {
+  return end();
+}
+
+template <class T, class Allocator>
+bool concurrent_vector<T, Allocator>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::size() const noexcept {
+  return _size.load();
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::max_size() const noexcept {
+  return slot_traits::max_size(slot_allocator(_alloc));
+}
+
+template <class T, class Allocator>
+void concurrent_vector<T, Allocator>::reserve(size_type new_cap) {
+  if (new_cap > max_size()) throw std::length_error("Too large size");
+  if (new_cap == 0) return;
+  for (size_type segment = 0; segment <= segment_of(new_cap - 1); ++segment)
+    ensure_segment(segment);
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::capacity() const noexcept {
+  size_type segment = 0;
+  while (segment < segment_count &&
+         _segments[segment].load(std::memory_order_acquire) != nullptr)
+    ++segment;
+  return segment_begin(segment);
+}
+
+template <class T, class Allocator>
+void concurrent_vector<T, Allocator>::clear() noexcept {
+  size_type size = _size.load(std::memory_order_relaxed);
+  size_type reserved = _reserved.load(std::memory_order_relaxed);
+  for (size_type index = 0; index < reserved; ++index) {
+    slot *item = find_slot(index);
+    if (item == nullptr) continue;
+    if (index < size || item->ready.load(std::memory_order_relaxed))
+      alloc_traits::destroy(_alloc, element(*item));
+    item->ready.store(false, std::memory_order_relaxed);
+  }
+  _reserved.store(0);
+  _size.store(0);
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::push_back(const T &value) {
+  return emplace_back(value);
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::push_back(T &&value) {
+  return emplace_back(std::move(value));
+}
+
+// A slot is only claimed once its segment exists, so allocation failures
+// surface before anything is taken; a CAS that loses to another thread
+// retries with the next index. The thread that claims the first slot of a
+// segment also allocates the following one, which keeps racing allocations
+// of large segments rare.
+template <class T, class Allocator>
+template <class... Args>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::emplace_back(Args &&...args) {
+  T value(std::forward<Args>(args)...);
+  size_type index = _reserved.load(std::memory_order_relaxed);
+  size_type segment;
+  slot *items;
+  do {
+    segment = segment_of(index);
+    items = ensure_segment(segment);
+  } while (!_reserved.compare_exchange_weak(index, index + 1,
+                                            std::memory_order_relaxed));
+  slot &item = items[index - segment_begin(segment)];
+  alloc_traits::construct(_alloc, element(item), std::move(value));
+  size_type expected = index;
+  if (!_size.compare_exchange_strong(expected, index + 1))
+    item.ready.store(true);
+  publish();
+  if (index == segment_begin(segment) && segment + 1 < segment_count) {
+    try {
+      ensure_segment(segment + 1);
+    } catch (...) {
+    }
+  }
+  return iterator(this, index);
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::segment_of(size_type index) noexcept {
+  return 63 - __builtin_clzll(index + first_segment_size) -
+         first_segment_bits;
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::segment_begin(size_type segment) noexcept {
+  return (first_segment_size << segment) - first_segment_size;
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::segment_size(size_type segment) noexcept {
+  return first_segment_size << segment;
+}
+
+template <class T, class Allocator>
+T *concurrent_vector<T, Allocator>::element(slot &item) noexcept {
+  return std::launder(reinterpret_cast<T *>(item.storage));
+}
+
+// Lock-free: threads that find the segment missing all allocate it, one
+// installs its copy and the others free theirs.
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::slot *
+concurrent_vector<T, Allocator>::ensure_segment(size_type segment) {
+  slot *items = _segments[segment].load(std::memory_order_acquire);
+  if (items != nullptr) return items;
+  slot_allocator slot_alloc(_alloc);
+  size_type count = segment_size(segment);
+  slot *fresh = slot_traits::allocate(slot_alloc, count);
+  for (size_type i = 0; i < count; ++i)
+    slot_traits::construct(slot_alloc, fresh + i);
+  if (_segments[segment].compare_exchange_strong(items, fresh,
+                                                 std::memory_order_acq_rel,
+                                                 std::memory_order_acquire))
+    return fresh;
+  for (size_type i = 0; i < count; ++i)
+    slot_traits::destroy(slot_alloc, fresh + i);
+  slot_traits::deallocate(slot_alloc, fresh, count);
+  return items;
+}
+
+template <class T, class Allocator>
+typename concurrent_vector<T, Allocator>::slot *
+concurrent_vector<T, Allocator>::find_slot(size_type index) const noexcept {
+  size_type segment = segment_of(index);
+  slot *items = _segments[segment].load(std::memory_order_acquire);
+  return items == nullptr ? nullptr : items + (index - segment_begin(segment));
+}
+
+// Advances _size over every ready slot at its front. An append whose slot is
+// at the front publishes it with one CAS and never touches the ready flag;
+// one that is not yet at the front marks its slot ready, and whichever thread
+// fills the gap carries _size past it. Sequentially consistent ordering
+// between the ready flags and _size guarantees one of the two always sees the
+// other.
+template <class T, class Allocator>
+void concurrent_vector<T, Allocator>::publish() noexcept {
+  size_type size = _size.load();
+  while (size < _reserved.load()) {
+    slot *item = find_slot(size);
+    if (item == nullptr || !item->ready.load()) break;
+    if (_size.compare_exchange_weak(size, size + 1)) ++size;
+  }
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::index_iterator(
+    container_type *vec, std::size_t pos) noexcept
+    : _vec(vec), _pos(pos) {}
+
+template <class T, class Allocator>
+template <bool IsConst>
+concurrent_vector<T, Allocator>::index_iterator<
+    IsConst>::index_iterator() noexcept
+    : _vec(nullptr), _pos(0) {}
+
+template <class T, class Allocator>
+template <bool IsConst>
+concurrent_vector<T, Allocator>::index_iterator<
+    IsConst>::operator index_iterator<true>() const noexcept {
+  return index_iterator<true>(_vec, _pos);
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<
+    IsConst>::reference
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator*() const {
+  return (*_vec)[_pos];
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<
+    IsConst>::pointer
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator->() const {
+  return &(*_vec)[_pos];
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<
+    IsConst>::reference
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator[](
+    difference_type n) const {
+  return (*_vec)[_pos + n];
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<IsConst> &
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator++() {
+  ++_pos;
+  return *this;
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<IsConst> &
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator--() {
+  --_pos;
+  return *this;
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<IsConst>
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator++(int) {
+  index_iterator result = *this;
+  ++_pos;
+  return result;
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<IsConst>
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator--(int) {
+  index_iterator result = *this;
+  --_pos;
+  return result;
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<IsConst>
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator+(
+    difference_type n) const {
+  return index_iterator(_vec, _pos + n);
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<IsConst>
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator-(
+    difference_type n) const {
+  return index_iterator(_vec, _pos - n);
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<IsConst> &
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator+=(
+    difference_type n) {
+  _pos += n;
+  return *this;
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<IsConst> &
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator-=(
+    difference_type n) {
+  _pos -= n;
+  return *this;
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+typename concurrent_vector<T, Allocator>::template index_iterator<
+    IsConst>::difference_type
+concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator-(
+    const index_iterator<true> &other) const {
+  return static_cast<difference_type>(_pos) -
+         static_cast<difference_type>(other._pos);
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+bool concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator==(
+    const index_iterator<true> &other) const noexcept {
+  return _pos == other._pos;
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+bool concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator!=(
+    const index_iterator<true> &other) const noexcept {
+  return _pos != other._pos;
+}
+
+template <class T, class Allocator>
+template <bool IsConst>
+bool concurrent_vector<T, Allocator>::index_iterator<IsConst>::operator<(
+    const index_iterator<true> &other) const noexcept {
+  return _pos < other._pos;
+}
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_VECTOR_H_
@@ -1,4 +1,23 @@
 #pragma once
 
+#include "s21_aligned_allocator.h"
+#include "s21_arena.h"
 #include "s21_array.h"
+#include "s21_binary_io.h"
+#include "s21_concurrent_vector.h"
+#include "s21_flat_hash_map.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
+#include "s21_growth_policy.h"
+#include "s21_incremental_vector.h"
+#include "s21_mapped_vector.h"
+#include "s21_memory.h"
+#include "s21_mmap_allocator.h"
+#include "s21_realloc_allocator.h"
+#include "s21_segmented_vector.h"
+#include "s21_small_vector.h"
+#include "s21_soa_vector.h"
+#include "s21_span.h"
+#include "s21_static_vector.h"
 #include "s21_vector.h"
+#include "s21_vector_stats.h"
@@ -0,0 +1,1060 @@
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "s21_containers.h"
+
+// vector benchmarks
+
+class non_relocatable_handle {
+ public:
+  explicit non_relocatable_handle(int value) : _ptr(new int(value)) {}
+  non_relocatable_handle(non_relocatable_handle &&other) noexcept
+      : _ptr(other._ptr) {
+    other._ptr = nullptr;
+  }
+  ~non_relocatable_handle() { delete _ptr; }
+
+ private:
+  int *_ptr;
+};
+
+template <class T>
+static void vector_growth(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::vector<T> vec;
+    for (int i = 0; i < count; ++i) vec.emplace_back(i);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void vector_growth_unique_ptr(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    s21::vector<std::unique_ptr<int>> vec;
+    for (int i = 0; i < count; ++i) vec.emplace_back(new int(i));
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(vector_growth, int)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_growth, non_relocatable_handle)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(vector_growth_unique_ptr)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+
+static void vector_fill_construction(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    s21::vector<float> vec(count, 1.0f);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float));
+}
+
+static void vector_value_construction(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    s21::vector<float> vec(count);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float));
+}
+
+static void vector_range_construction(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  s21::vector<float> source(count, 1.0f);
+  for (auto _ : state) {
+    s21::vector<float> vec(source.begin(), source.end());
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float));
+}
+
+static void vector_copy_construction(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  s21::vector<float> source(count, 1.0f);
+  for (auto _ : state) {
+    s21::vector<float> vec(source);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float));
+}
+
+// Fills a buffer right after sizing it, as read() or a decoder would.
+template <bool ForOverwrite>
+static void vector_resize_then_write(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    s21::vector<char> vec;
+    if constexpr (ForOverwrite)
+      vec.resize_for_overwrite(count);
+    else
+      vec.resize(count);
+    std::memset(vec.data(), 'x', count);
+    benchmark::DoNotOptimize(vec.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * count);
+}
+
+BENCHMARK(vector_fill_construction)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(vector_value_construction)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(vector_range_construction)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(vector_copy_construction)
+    ->RangeMultiplier(10)
+    ->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_resize_then_write, false)
+    ->Arg(1 << 30)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_resize_then_write, true)
+    ->Arg(1 << 30)
+    ->Unit(benchmark::kMillisecond);
+
+struct allocation_tracker {
+  static inline std::size_t current_bytes = 0;
+  static inline std::size_t peak_bytes = 0;
+};
+
+template <class T>
+struct tracking_allocator {
+  using value_type = T;
+
+  tracking_allocator() = default;
+  template <class U>
+  tracking_allocator(const tracking_allocator<U> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    allocation_tracker::current_bytes += n * sizeof(T);
+    if (allocation_tracker::current_bytes > allocation_tracker::peak_bytes)
+      allocation_tracker::peak_bytes = allocation_tracker::current_bytes;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) noexcept {
+    allocation_tracker::current_bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const tracking_allocator &) const noexcept { return true; }
+  bool operator!=(const tracking_allocator &) const noexcept { return false; }
+};
+
+template <class GrowthPolicy>
+static void vector_growth_policy(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  std::size_t capacity = 0;
+  allocation_tracker::peak_bytes = 0;
+  for (auto _ : state) {
+    s21::vector<double, tracking_allocator<double>, GrowthPolicy> vec;
+    for (std::size_t i = 0; i < count; ++i) vec.push_back(i);
+    benchmark::DoNotOptimize(vec.data());
+    capacity = vec.capacity();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.counters["peak_MiB"] =
+      static_cast<double>(allocation_tracker::peak_bytes) / (1 << 20);
+  state.counters["slack_pct"] = 100.0 * (capacity - count) / capacity;
+}
+
+BENCHMARK_TEMPLATE(vector_growth_policy, s21::doubling_growth)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_growth_policy, s21::one_and_half_growth)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_growth_policy, s21::size_class_growth<>)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_growth_policy, s21::capped_growth<>)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+
+template <class Allocator>
+static void vector_realloc_growth(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    s21::vector<double, Allocator> vec;
+    for (std::size_t i = 0; i < count; ++i) vec.push_back(i);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(vector_realloc_growth, std::allocator<double>)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_realloc_growth, s21::realloc_allocator<double>)
+    ->RangeMultiplier(10)
+    ->Range(1000000, 100000000)
+    ->Unit(benchmark::kMillisecond);
+
+template <class Allocator>
+static void vector_sequential_scan(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  s21::vector<double, Allocator> vec(count, 1.0);
+  for (auto _ : state) {
+    double sum = 0;
+    for (std::size_t i = 0; i < count; ++i) sum += vec[i];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(double));
+}
+
+template <class Allocator>
+static void vector_page_stride_scan(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  const std::size_t stride = 4096 / sizeof(double) + 1;
+  s21::vector<double, Allocator> vec(count, 1.0);
+  for (auto _ : state) {
+    double sum = 0;
+    for (std::size_t start = 0; start < stride; ++start)
+      for (std::size_t i = start; i < count; i += stride) sum += vec[i];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(vector_sequential_scan, std::allocator<double>)
+    ->Arg(1 << 26)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_sequential_scan, s21::mmap_allocator<double>)
+    ->Arg(1 << 26)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_page_stride_scan, std::allocator<double>)
+    ->Arg(1 << 26)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(vector_page_stride_scan, s21::mmap_allocator<double>)
+    ->Arg(1 << 26)
+    ->Unit(benchmark::kMillisecond);
+
+template <class Allocator>
+static void vector_saxpy(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  s21::vector<float, Allocator> x(count, 1.0f);
+  s21::vector<float, Allocator> y(count, 2.0f);
+  for (auto _ : state) {
+    float *out = y.data();
+    const float *in = x.data();
+    for (std::size_t i = 0; i < count; ++i) out[i] = 0.5f * in[i] + out[i];
+    benchmark::DoNotOptimize(y.data());
+  }
+  state.SetBytesProcessed(state.iterations() * count * 2 * sizeof(float));
+}
+
+BENCHMARK_TEMPLATE(vector_saxpy, std::allocator<float>)
+    ->Arg(1000)
+    ->Arg(10000);
+BENCHMARK_TEMPLATE(vector_saxpy, s21::aligned_allocator<float, 64>)
+    ->Arg(1000)
+    ->Arg(10000);
+
+template <class Allocator>
+static void build_temporary_vectors(int count, const Allocator &alloc) {
+  for (int j = 0; j < 32; ++j) {
+    s21::vector<int, Allocator> vec(alloc);
+    for (int i = 0; i < count; ++i) vec.push_back(i);
+    benchmark::DoNotOptimize(vec.data());
+  }
+}
+
+static void temporary_vectors_std(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) build_temporary_vectors(count, std::allocator<int>());
+  state.SetItemsProcessed(state.iterations() * count * 32);
+}
+
+static void temporary_vectors_arena(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  s21::arena arena;
+  for (auto _ : state) {
+    build_temporary_vectors(count, s21::arena_allocator<int>(arena));
+    arena.release();
+  }
+  state.SetItemsProcessed(state.iterations() * count * 32);
+}
+
+BENCHMARK(temporary_vectors_std)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(temporary_vectors_arena)->RangeMultiplier(8)->Range(8, 4096);
+
+// small_vector benchmarks
+
+template <class Vector>
+static void short_vector_fill(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Vector vec;
+    for (int i = 0; i < count; ++i) vec.emplace_back(i);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(short_vector_fill, s21::vector<int>)->DenseRange(4, 16, 4);
+BENCHMARK_TEMPLATE(short_vector_fill, s21::small_vector<int, 16>)
+    ->DenseRange(4, 16, 4);
+BENCHMARK_TEMPLATE(short_vector_fill, s21::static_vector<int, 16>)
+    ->DenseRange(4, 16, 4);
+
+// soa_vector benchmarks
+
+struct particle {
+  float x, y, z;
+  float vx, vy, vz;
+  float mass;
+  std::int32_t id;
+};
+
+static void particle_field_scan_aos(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  s21::vector<particle> particles(count, particle{1, 2, 3, 4, 5, 6, 7, 8});
+  for (auto _ : state) {
+    float sum = 0;
+    for (const particle &p : particles) sum += p.mass;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float));
+}
+
+static void particle_field_scan_soa(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  s21::soa_vector<float, float, float, float, float, float, float,
+                  std::int32_t>
+      particles;
+  particles.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+    particles.emplace_back(1, 2, 3, 4, 5, 6, 7, 8);
+  for (auto _ : state) {
+    float sum = 0;
+    for (float mass : particles.column<6>()) sum += mass;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(float));
+}
+
+BENCHMARK(particle_field_scan_aos)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 24)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(particle_field_scan_soa)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 24)
+    ->Unit(benchmark::kMicrosecond);
+
+// Bulk append benchmarks
+
+static void ingest_push_back_loop(benchmark::State &state) {
+  std::vector<int> source(state.range(0), 7);
+  for (auto _ : state) {
+    s21::vector<int> vec;
+    for (int value : source) vec.push_back(value);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+static void ingest_append(benchmark::State &state) {
+  std::vector<int> source(state.range(0), 7);
+  for (auto _ : state) {
+    s21::vector<int> vec;
+    vec.append(source.begin(), source.end());
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+static void ingest_emplace_back_loop(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    s21::vector<double> vec;
+    for (std::size_t i = 0; i < count; ++i) vec.emplace_back(1.5);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void ingest_emplace_back_n(benchmark::State &state) {
+  const std::size_t count = state.range(0);
+  for (auto _ : state) {
+    s21::vector<double> vec;
+    vec.emplace_back_n(count, 1.5);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <bool Unchecked>
+static void ingest_reserved_push_back(benchmark::State &state) {
+  const int count = state.range(0);
+  for (auto _ : state) {
+    s21::vector<int> vec;
+    vec.reserve(count);
+    for (int i = 0; i < count; ++i) {
+      if constexpr (Unchecked)
+        vec.push_back_unchecked(i);
+      else
+        vec.push_back(i);
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(ingest_push_back_loop)->Arg(1000000);
+BENCHMARK(ingest_append)->Arg(1000000);
+BENCHMARK(ingest_emplace_back_loop)->Arg(1000000);
+BENCHMARK(ingest_emplace_back_n)->Arg(1000000);
+BENCHMARK_TEMPLATE(ingest_reserved_push_back, false)->Arg(1000000);
+BENCHMARK_TEMPLATE(ingest_reserved_push_back, true)->Arg(1000000);
+
+// segmented_vector benchmarks
+
+// Log-linear histogram of latencies in nanoseconds: 16 linear buckets per
+// power of two, so percentiles are within about 6% from a fixed 8 KB table
+// and recording never allocates.
+class latency_histogram {
+ public:
+  void record(std::uint64_t ns) {
+    ++_counts[bucket(ns)];
+    ++_total;
+    _max = std::max(_max, ns);
+  }
+
+  std::uint64_t percentile(double fraction) const {
+    if (fraction >= 1.0) return _max;
+    auto rank = static_cast<std::uint64_t>(fraction * (_total - 1));
+    std::uint64_t seen = 0;
+    for (std::size_t index = 0; index < _counts.size(); ++index) {
+      seen += _counts[index];
+      if (seen > rank) return bucket_floor(index);
+    }
+    return _max;
+  }
+
+ private:
+  static std::size_t bucket(std::uint64_t ns) {
+    if (ns < 16) return ns;
+    int msb = 63 - __builtin_clzll(ns);
+    return (msb - 3) * 16 + ((ns >> (msb - 4)) & 15);
+  }
+
+  static std::uint64_t bucket_floor(std::size_t index) {
+    if (index < 16) return index;
+    return (16 + index % 16) << (index / 16 - 1);
+  }
+
+  std::array<std::uint64_t, 61 * 16> _counts{};
+  std::uint64_t _total = 0;
+  std::uint64_t _max = 0;
+};
+
+// Times every push_back separately and reports latency percentiles.
+template <class Vector>
+static void push_back_tail_latency(benchmark::State &state) {
+  const int count = state.range(0);
+  latency_histogram latencies;
+  for (auto _ : state) {
+    Vector vec;
+    for (int i = 0; i < count; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      vec.push_back(i);
+      auto elapsed = std::chrono::steady_clock::now() - start;
+      latencies.record(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+              .count());
+    }
+    benchmark::DoNotOptimize(vec.back());
+  }
+  state.counters["p50_ns"] = latencies.percentile(0.5);
+  state.counters["p99_ns"] = latencies.percentile(0.99);
+  state.counters["p99.99_ns"] = latencies.percentile(0.9999);
+  state.counters["max_ns"] = latencies.percentile(1.0);
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(push_back_tail_latency, s21::vector<int>)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(push_back_tail_latency, s21::segmented_vector<int>)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(push_back_tail_latency, s21::incremental_vector<int>)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+
+// concurrent_vector benchmarks
+
+static s21::concurrent_vector<int> *shared_concurrent_vector;
+static s21::vector<int> *shared_locked_vector;
+static std::mutex shared_vector_mutex;
+
+static void parallel_push_back_concurrent(benchmark::State &state) {
+  if (state.thread_index() == 0)
+    shared_concurrent_vector = new s21::concurrent_vector<int>;
+  int value = state.thread_index();
+  for (auto _ : state) shared_concurrent_vector->push_back(value);
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) delete shared_concurrent_vector;
+}
+
+static void parallel_push_back_mutex(benchmark::State &state) {
+  if (state.thread_index() == 0) shared_locked_vector = new s21::vector<int>;
+  int value = state.thread_index();
+  for (auto _ : state) {
+    std::lock_guard<std::mutex> lock(shared_vector_mutex);
+    shared_locked_vector->push_back(value);
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) delete shared_locked_vector;
+}
+
+BENCHMARK(parallel_push_back_concurrent)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(parallel_push_back_mutex)->ThreadRange(1, 64)->UseRealTime();
+
+// flat_map benchmarks
+
+// Scattered keys; every other query misses.
+static std::vector<std::pair<int, int>> lookup_entries(int count) {
+  std::vector<std::pair<int, int>> entries;
+  for (int i = 0; i < count; ++i)
+    entries.emplace_back(static_cast<int>(i * 2654435761u % 1000003u) * 2, i);
+  return entries;
+}
+
+template <class Map>
+static void map_lookup(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  std::vector<std::pair<int, int>> entries = lookup_entries(count);
+  Map map(entries.begin(), entries.end());
+  std::vector<int> queries;
+  for (int i = 0; i < 4096; ++i)
+    queries.push_back(entries[i * 7919 % count].first + i % 2);
+  for (auto _ : state) {
+    long found = 0;
+    for (int key : queries) found += map.count(key);
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+template <class Map>
+static void map_iteration(benchmark::State &state) {
+  std::vector<std::pair<int, int>> entries =
+      lookup_entries(static_cast<int>(state.range(0)));
+  Map map(entries.begin(), entries.end());
+  for (auto _ : state) {
+    long sum = 0;
+    for (const auto &entry : map) sum += entry.second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+static void flat_map_value_scan(benchmark::State &state) {
+  std::vector<std::pair<int, int>> entries =
+      lookup_entries(static_cast<int>(state.range(0)));
+  s21::flat_map<int, int> map(entries.begin(), entries.end());
+  for (auto _ : state) {
+    long sum = 0;
+    for (int value : map.values()) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * map.size());
+}
+
+template <bool Bulk>
+static void flat_map_build(benchmark::State &state) {
+  std::vector<std::pair<int, int>> entries =
+      lookup_entries(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::flat_map<int, int> map;
+    if (Bulk) {
+      map.insert(entries.begin(), entries.end());
+    } else {
+      for (const auto &entry : entries) map.insert(entry);
+    }
+    benchmark::DoNotOptimize(map.values().data());
+  }
+  state.SetItemsProcessed(state.iterations() * entries.size());
+}
+
+BENCHMARK_TEMPLATE(map_lookup, s21::flat_map<int, int>)
+    ->Arg(1000)
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(map_lookup, std::map<int, int>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(map_lookup, std::unordered_map<int, int>)
+    ->Arg(1000)
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(map_iteration, s21::flat_map<int, int>)
+    ->Arg(1000)
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(map_iteration, std::map<int, int>)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(map_iteration, std::unordered_map<int, int>)
+    ->Arg(1000)
+    ->Arg(100000);
+BENCHMARK(flat_map_value_scan)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(flat_map_build, false)->Arg(10000);
+BENCHMARK_TEMPLATE(flat_map_build, true)->Arg(10000);
+
+// flat_hash_map benchmarks
+
+// Both tables get 2^16 slots or buckets up front and are filled to the load
+// factor given in permille, so growth never runs inside the timed loop.
+static constexpr std::size_t hash_bench_slots = std::size_t(1) << 16;
+
+static std::vector<std::uint64_t> hash_bench_keys(std::size_t count,
+                                                  std::uint64_t seed) {
+  std::vector<std::uint64_t> keys;
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint64_t key = (i + seed) * 0x9e3779b97f4a7c15ULL;
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    keys.push_back(key ^ (key >> 31));
+  }
+  return keys;
+}
+
+template <class Map>
+static Map filled_hash_map(const std::vector<std::uint64_t> &keys) {
+  Map map;
+  map.rehash(hash_bench_slots);
+  for (std::uint64_t key : keys) map.emplace(key, key);
+  return map;
+}
+
+template <class Map>
+static void hash_insert(benchmark::State &state) {
+  std::vector<std::uint64_t> keys =
+      hash_bench_keys(hash_bench_slots * state.range(0) / 1000, 0);
+  for (auto _ : state) {
+    Map map = filled_hash_map<Map>(keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Half of the queries hit.
+template <class Map>
+static void hash_find(benchmark::State &state) {
+  std::vector<std::uint64_t> keys =
+      hash_bench_keys(hash_bench_slots * state.range(0) / 1000, 0);
+  Map map = filled_hash_map<Map>(keys);
+  std::vector<std::uint64_t> queries =
+      hash_bench_keys(keys.size(), keys.size() / 2);
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (std::uint64_t key : queries) found += map.count(key);
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+template <class Map>
+static void hash_erase(benchmark::State &state) {
+  std::vector<std::uint64_t> keys =
+      hash_bench_keys(hash_bench_slots * state.range(0) / 1000, 0);
+  Map filled = filled_hash_map<Map>(keys);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Map map = filled;
+    state.ResumeTiming();
+    for (std::uint64_t key : keys) map.erase(key);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void hash_load_factors(benchmark::internal::Benchmark *bench) {
+  for (int permille : {500, 625, 750, 875}) bench->Arg(permille);
+}
+
+using s21_hash_map = s21::flat_hash_map<std::uint64_t, std::uint64_t>;
+using std_hash_map = std::unordered_map<std::uint64_t, std::uint64_t>;
+
+BENCHMARK_TEMPLATE(hash_insert, s21_hash_map)->Apply(hash_load_factors);
+BENCHMARK_TEMPLATE(hash_insert, std_hash_map)->Apply(hash_load_factors);
+BENCHMARK_TEMPLATE(hash_find, s21_hash_map)->Apply(hash_load_factors);
+BENCHMARK_TEMPLATE(hash_find, std_hash_map)->Apply(hash_load_factors);
+BENCHMARK_TEMPLATE(hash_erase, s21_hash_map)->Apply(hash_load_factors);
+BENCHMARK_TEMPLATE(hash_erase, std_hash_map)->Apply(hash_load_factors);
+
+// binary image benchmarks
+
+static const char *const binary_bench_path = "/tmp/s21_binary_bench.bin";
+
+static s21::vector<double> binary_bench_data(std::size_t count) {
+  s21::vector<double> vec(count);
+  for (std::size_t i = 0; i < count; ++i) vec[i] = i * 0.5;
+  return vec;
+}
+
+static void checkpoint_write_stream(benchmark::State &state) {
+  s21::vector<double> vec = binary_bench_data(state.range(0));
+  for (auto _ : state) {
+    std::ofstream out(binary_bench_path, std::ios::binary);
+    for (const double &value : vec)
+      out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+  state.SetBytesProcessed(state.iterations() * vec.size() * sizeof(double));
+  std::remove(binary_bench_path);
+}
+
+static void checkpoint_write_binary(benchmark::State &state) {
+  s21::vector<double> vec = binary_bench_data(state.range(0));
+  for (auto _ : state) {
+    int fd = open(binary_bench_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    s21::write_binary(fd, vec);
+    close(fd);
+  }
+  state.SetBytesProcessed(state.iterations() * vec.size() * sizeof(double));
+  std::remove(binary_bench_path);
+}
+
+static void checkpoint_read_stream(benchmark::State &state) {
+  {
+    std::ofstream out(binary_bench_path, std::ios::binary);
+    for (const double &value : binary_bench_data(state.range(0)))
+      out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+  for (auto _ : state) {
+    std::ifstream in(binary_bench_path, std::ios::binary);
+    s21::vector<double> vec;
+    double value;
+    while (in.read(reinterpret_cast<char *>(&value), sizeof(value)))
+      vec.push_back(value);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(double));
+  std::remove(binary_bench_path);
+}
+
+static void checkpoint_read_binary(benchmark::State &state) {
+  int fd = open(binary_bench_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  s21::write_binary(fd, binary_bench_data(state.range(0)));
+  close(fd);
+  for (auto _ : state) {
+    fd = open(binary_bench_path, O_RDONLY);
+    s21::vector<double> vec;
+    s21::read_binary(fd, vec);
+    close(fd);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(double));
+  std::remove(binary_bench_path);
+}
+
+// Validating a mapped image costs one checksum pass and no copy.
+static void checkpoint_view_binary(benchmark::State &state) {
+  {
+    int fd = open(binary_bench_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    s21::write_binary(fd, binary_bench_data(state.range(0)));
+    close(fd);
+  }
+  int fd = open(binary_bench_path, O_RDONLY);
+  std::size_t bytes = s21::binary_image_size<double>(state.range(0));
+  void *image = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  for (auto _ : state) {
+    s21::span<const double> view = s21::view_binary<double>(image, bytes);
+    benchmark::DoNotOptimize(view.data());
+  }
+  munmap(image, bytes);
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          sizeof(double));
+  std::remove(binary_bench_path);
+}
+
+BENCHMARK(checkpoint_write_stream)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(checkpoint_write_binary)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(checkpoint_read_stream)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(checkpoint_read_binary)->Arg(1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(checkpoint_view_binary)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// STL comparison benchmarks
+
+struct pod64 {
+  std::int64_t values[8];
+};
+
+class move_only {
+ public:
+  explicit move_only(int value) : _ptr(new int(value)) {}
+  move_only(move_only &&other) noexcept = default;
+  move_only &operator=(move_only &&other) noexcept = default;
+  int value() const noexcept { return *_ptr; }
+
+ private:
+  std::unique_ptr<int> _ptr;
+};
+
+template <class T>
+T make_value(int i) {
+  if constexpr (std::is_same_v<T, pod64>) {
+    return pod64{{i, i, i, i, i, i, i, i}};
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return std::string("a string long enough to allocate #") +
+           std::to_string(i);
+  } else {
+    return T(i);
+  }
+}
+
+template <class T>
+std::int64_t value_key(const T &value) {
+  if constexpr (std::is_same_v<T, pod64>) {
+    return value.values[0];
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return value.size();
+  } else if constexpr (std::is_same_v<T, move_only>) {
+    return value.value();
+  } else {
+    return value;
+  }
+}
+
+template <class Vector>
+Vector make_filled(int count) {
+  Vector vec;
+  vec.reserve(count);
+  for (int i = 0; i < count; ++i)
+    vec.push_back(make_value<typename Vector::value_type>(i));
+  return vec;
+}
+
+template <class Vector>
+static void stl_push_back(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Vector vec;
+    for (int i = 0; i < count; ++i) vec.push_back(make_value<T>(i));
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void stl_emplace_back(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Vector vec;
+    for (int i = 0; i < count; ++i) vec.emplace_back(make_value<T>(i));
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void stl_reserve_push_back(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Vector vec;
+    vec.reserve(count);
+    for (int i = 0; i < count; ++i) vec.push_back(make_value<T>(i));
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void stl_middle_insert_erase(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const int count = static_cast<int>(state.range(0));
+  Vector vec = make_filled<Vector>(count);
+  for (auto _ : state) {
+    for (int i = 0; i < 16; ++i)
+      vec.insert(vec.begin() + count / 2, make_value<T>(i));
+    for (int i = 0; i < 16; ++i) vec.erase(vec.begin() + count / 2);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 32);
+}
+
+template <class Vector>
+static void stl_positional_insert_erase(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const int count = static_cast<int>(state.range(0));
+  const int pos = static_cast<int>(count * state.range(1) / 100);
+  Vector vec = make_filled<Vector>(count);
+  vec.reserve(count + 1);
+  const T value = make_value<T>(-1);
+  for (auto _ : state) {
+    vec.insert(vec.begin() + pos, value);
+    vec.erase(vec.begin() + pos);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+
+template <class Vector>
+static void stl_copy_construction(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  Vector source = make_filled<Vector>(count);
+  for (auto _ : state) {
+    Vector vec(source);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Vector>
+static void stl_move_construction(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  Vector source = make_filled<Vector>(count);
+  for (auto _ : state) {
+    Vector vec(std::move(source));
+    benchmark::DoNotOptimize(vec.data());
+    source = std::move(vec);
+  }
+}
+
+template <class Container>
+static void stl_iteration(benchmark::State &state, Container &container) {
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (const auto &value : container) sum += value_key(value);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * container.size());
+}
+
+template <class Vector>
+static void stl_vector_iteration(benchmark::State &state) {
+  Vector vec = make_filled<Vector>(static_cast<int>(state.range(0)));
+  stl_iteration(state, vec);
+}
+
+template <class Vector>
+static void stl_vector_fill(benchmark::State &state) {
+  using T = typename Vector::value_type;
+  const int count = static_cast<int>(state.range(0));
+  Vector vec = make_filled<Vector>(count);
+  const T value = make_value<T>(-1);
+  for (auto _ : state) {
+    vec.assign(count, value);
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <class Array>
+static void stl_array_iteration(benchmark::State &state) {
+  using T = typename Array::value_type;
+  auto arr = std::make_unique<Array>();
+  for (std::size_t i = 0; i < arr->size(); ++i)
+    (*arr)[i] = make_value<T>(static_cast<int>(i));
+  stl_iteration(state, *arr);
+}
+
+template <class Array>
+static void stl_array_fill(benchmark::State &state) {
+  using T = typename Array::value_type;
+  auto arr = std::make_unique<Array>();
+  const T value = make_value<T>(-1);
+  for (auto _ : state) {
+    arr->fill(value);
+    benchmark::DoNotOptimize(arr->data());
+  }
+  state.SetItemsProcessed(state.iterations() * arr->size());
+}
+
+template <class Array>
+static void stl_array_copy(benchmark::State &state) {
+  auto source = std::make_unique<Array>();
+  auto arr = std::make_unique<Array>();
+  for (auto _ : state) {
+    *arr = *source;
+    benchmark::DoNotOptimize(arr->data());
+  }
+  state.SetItemsProcessed(state.iterations() * arr->size());
+}
+
+#define STL_VECTOR_BENCHMARK(name, T, count)            \
+  BENCHMARK_TEMPLATE(name, s21::vector<T>)->Arg(count); \
+  BENCHMARK_TEMPLATE(name, std::vector<T>)->Arg(count)
+
+#define STL_ARRAY_BENCHMARK(name, T, N)       \
+  BENCHMARK_TEMPLATE(name, s21::array<T, N>); \
+  BENCHMARK_TEMPLATE(name, std::array<T, N>)
+
+#define STL_VECTOR_BENCHMARKS(T)                             \
+  STL_VECTOR_BENCHMARK(stl_push_back, T, 1 << 16);           \
+  STL_VECTOR_BENCHMARK(stl_emplace_back, T, 1 << 16);        \
+  STL_VECTOR_BENCHMARK(stl_reserve_push_back, T, 1 << 16);   \
+  STL_VECTOR_BENCHMARK(stl_middle_insert_erase, T, 1 << 14); \
+  STL_VECTOR_BENCHMARK(stl_move_construction, T, 1 << 16);   \
+  STL_VECTOR_BENCHMARK(stl_vector_iteration, T, 1 << 16)
+
+#define STL_COPYABLE_BENCHMARKS(T)                         \
+  STL_VECTOR_BENCHMARK(stl_copy_construction, T, 1 << 16); \
+  STL_VECTOR_BENCHMARK(stl_vector_fill, T, 1 << 16);       \
+  STL_ARRAY_BENCHMARK(stl_array_iteration, T, 1 << 12);    \
+  STL_ARRAY_BENCHMARK(stl_array_fill, T, 1 << 12);         \
+  STL_ARRAY_BENCHMARK(stl_array_copy, T, 1 << 12)
+
+static void positional_args(benchmark::internal::Benchmark *bench) {
+  bench->ArgsProduct({benchmark::CreateRange(1000, 10000000, 10), {0, 50, 100}})
+      ->ArgNames({"size", "pos_pct"});
+}
+
+#define STL_POSITIONAL_BENCHMARK(T)                               \
+  BENCHMARK_TEMPLATE(stl_positional_insert_erase, s21::vector<T>) \
+      ->Apply(positional_args);                                   \
+  BENCHMARK_TEMPLATE(stl_positional_insert_erase, std::vector<T>) \
+      ->Apply(positional_args)
+
+STL_VECTOR_BENCHMARKS(int);
+STL_VECTOR_BENCHMARKS(pod64);
+STL_VECTOR_BENCHMARKS(std::string);
+STL_VECTOR_BENCHMARKS(move_only);
+STL_COPYABLE_BENCHMARKS(int);
+STL_COPYABLE_BENCHMARKS(pod64);
+STL_COPYABLE_BENCHMARKS(std::string);
+STL_POSITIONAL_BENCHMARK(int);
+STL_POSITIONAL_BENCHMARK(pod64);
+STL_POSITIONAL_BENCHMARK(std::string);
+
+BENCHMARK_MAIN();
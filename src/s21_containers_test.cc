@@ -2,7 +2,26 @@
 
 #include <gtest/gtest.h>
 
+#include <unistd.h>
+
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 // array tests
@@ -263,6 +282,96 @@ TEST(array, modifiers) {
   EXPECT_EQ(compare_to_std(stdarr1, s21arr1, true), true);
 }
 
+struct adl_swap_counter {
+  int value;
+  static inline int swaps = 0;
+  friend void swap(adl_swap_counter &lhs, adl_swap_counter &rhs) noexcept {
+    std::swap(lhs.value, rhs.value);
+    ++swaps;
+  }
+};
+
+TEST(array, adl_swap) {
+  s21::array<adl_swap_counter, 3> s21arr1 = {{{1}, {2}, {3}}};
+  s21::array<adl_swap_counter, 3> s21arr2 = {{{4}, {5}, {6}}};
+  s21arr1.swap(s21arr2);
+  EXPECT_EQ(adl_swap_counter::swaps, 3);
+  EXPECT_EQ(s21arr1[0].value, 4);
+  EXPECT_EQ(s21arr2[2].value, 3);
+}
+
+constexpr s21::array<std::uint32_t, 256> make_crc32_table() {
+  s21::array<std::uint32_t, 256> table{};
+  for (std::uint32_t i = 0; i < table.size(); ++i) {
+    std::uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit)
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320U : crc >> 1;
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr s21::array<int, 4> make_swapped_array() {
+  s21::array<int, 4> arr1{};
+  s21::array<int, 4> arr2 = {1, 2, 3, 4};
+  arr1.fill(7);
+  arr1.front() = 0;
+  swap(arr1, arr2);
+  arr1.at(3) = s21::get<0>(arr2);
+  return arr1;
+}
+
+TEST(array, constexpr_interface) {
+  constexpr s21::array<std::uint32_t, 256> crc_table = make_crc32_table();
+  static_assert(crc_table[1] == 0x77073096U);
+  static_assert(crc_table.back() == 0x2D02EF8DU);
+  static_assert(crc_table.size() == 256 && !crc_table.empty());
+
+  constexpr s21::array<int, 4> arr1 = make_swapped_array();
+  static_assert(arr1[0] == 1 && arr1.at(3) == 0);
+  static_assert(*arr1.cbegin() == 1 && *(arr1.cend() - 2) == 3);
+  static_assert(*arr1.crbegin() == 0 && *(arr1.crend() - 1) == 1);
+  static_assert(s21::get<1>(arr1) == 2);
+  static_assert(std::tuple_size<s21::array<int, 4>>::value == 4);
+  static_assert(
+      std::is_same_v<std::tuple_element_t<2, s21::array<int, 4>>, int>);
+
+  constexpr s21::array<int, 4> arr2 = {1, 2, 3, 4};
+  static_assert(arr1 != arr2 && arr1 < arr2 && arr2 > arr1);
+  static_assert(arr1 <= arr2 && arr2 >= arr1 && arr2 == arr2);
+
+  constexpr auto arr3 = s21::to_array({5, 6, 7});
+  static_assert(std::is_same_v<decltype(arr3), const s21::array<int, 3>>);
+  static_assert(arr3.front() == 5 && arr3.back() == 7);
+
+  const char chars[] = "abc";
+  s21::array<char, 4> arr4 = s21::to_array(chars);
+  EXPECT_EQ(arr4[2], 'c');
+  EXPECT_EQ(arr4[3], '\0');
+
+  auto [first, second, third] = arr3;
+  EXPECT_EQ(first + second + third, 18);
+  s21::array<std::string, 2> arr5 = {"moved", "kept"};
+  std::string moved = s21::get<0>(std::move(arr5));
+  EXPECT_EQ(moved, "moved");
+  EXPECT_EQ(s21::get<1>(arr5), "kept");
+}
+
+TEST(array, aligned) {
+  std::array<float, 5> stdarr1 = {1, 2, 3, 4, 5};
+  s21::aligned_array<float, 5, 32> s21arr1 = {1, 2, 3, 4, 5};
+  s21::aligned_array<double, 3> s21arr2[3] = {};
+
+  EXPECT_EQ(compare_to_std(stdarr1, s21arr1, true), true);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21arr1.data()) % 32, 0U);
+  EXPECT_EQ(s21arr1.begin(), s21arr1.data());
+  for (const auto &arr : s21arr2) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(arr.data()) % 64, 0U);
+    EXPECT_EQ(arr.cbegin(), arr.cend() - 3);
+  }
+  EXPECT_EQ(alignof(s21::aligned_array<char, 1, 128>), 128U);
+}
+
 // vector tests
 
 TEST(vector, constructors) {
@@ -800,6 +909,1727 @@ TEST(vector, throws) {
   catched = false;
 }
 
+struct relocatable_handle {
+  relocatable_handle(int value) : ptr(new int(value)) {}
+  relocatable_handle(relocatable_handle &&other) noexcept : ptr(other.ptr) {
+    other.ptr = nullptr;
+  }
+  ~relocatable_handle() { delete ptr; }
+
+  int *ptr;
+};
+
+template <>
+struct s21::is_trivially_relocatable<relocatable_handle> : std::true_type {};
+
+TEST(vector, relocation) {
+  static_assert(s21::is_trivially_relocatable_v<int>);
+  static_assert(s21::is_trivially_relocatable_v<std::unique_ptr<int>>);
+  static_assert(s21::is_trivially_relocatable_v<relocatable_handle>);
+  static_assert(!s21::is_trivially_relocatable_v<tester_class>);
+
+  s21::vector<std::unique_ptr<int>> s21vec1;
+  for (int i = 0; i < 100; ++i) s21vec1.push_back(std::make_unique<int>(i));
+  s21vec1.insert(s21vec1.begin() + 50, std::make_unique<int>(-1));
+  s21vec1.emplace(s21vec1.begin(), new int(-2));
+  s21vec1.shrink_to_fit();
+  EXPECT_EQ(s21vec1.size(), 102U);
+  EXPECT_EQ(*s21vec1[0], -2);
+  EXPECT_EQ(*s21vec1[51], -1);
+  EXPECT_EQ(*s21vec1[101], 99);
+
+  s21::vector<relocatable_handle> s21vec2;
+  for (int i = 0; i < 100; ++i) s21vec2.emplace_back(i);
+  s21vec2.reserve(1000);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(*s21vec2[i].ptr, i);
+
+  s21::vector<std::string> s21vec3(5, std::string(100, 'a'));
+  s21vec3.reserve(100);
+  s21vec3.insert(s21vec3.begin() + 2, std::string(100, 'b'));
+  EXPECT_EQ(s21vec3[2], std::string(100, 'b'));
+  EXPECT_EQ(s21vec3[5], std::string(100, 'a'));
+
+  s21::vector<throw_tester_class> s21vec4(3);
+  throw_tester_class thrower;
+  thrower.n = 1;
+  bool catched = false;
+  try {
+    s21vec4.insert(s21vec4.begin() + 1, 2, thrower);
+  } catch (...) {
+    catched = true;
+  }
+  EXPECT_EQ(catched, true);
+  EXPECT_EQ(s21vec4.size(), 3U);
+}
+
+TEST(vector, bulk_construction) {
+  std::vector<float> stdvec1(1000);
+  s21::vector<float> s21vec1(1000);
+  EXPECT_EQ(compare_to_std(stdvec1, s21vec1, true), true);
+
+  std::vector<float> stdvec2(1000, 1.5f);
+  s21::vector<float> s21vec2(1000, 1.5f);
+  EXPECT_EQ(compare_to_std(stdvec2, s21vec2, true), true);
+
+  std::vector<float> stdvec3(stdvec2.begin() + 10, stdvec2.end());
+  s21::vector<float> s21vec3(s21vec2.begin() + 10, s21vec2.end());
+  EXPECT_EQ(compare_to_std(stdvec3, s21vec3, true), true);
+
+  std::vector<float> stdvec4(stdvec3);
+  s21::vector<float> s21vec4(s21vec3);
+  EXPECT_EQ(compare_to_std(stdvec4, s21vec4, true), true);
+
+  stdvec4.resize(2000);
+  s21vec4.resize(2000);
+  EXPECT_EQ(compare_to_std(stdvec4, s21vec4, true), true);
+
+  stdvec4.resize(4000, 2.5f);
+  s21vec4.resize(4000, 2.5f);
+  EXPECT_EQ(compare_to_std(stdvec4, s21vec4, true), true);
+
+  stdvec4.assign(stdvec1.begin(), stdvec1.end());
+  s21vec4.assign(s21vec1.begin(), s21vec1.end());
+  EXPECT_EQ(compare_to_std(stdvec4, s21vec4, true), true);
+
+  std::vector<std::string> stdvec5(100, "string");
+  s21::vector<std::string> s21vec5(stdvec5.begin(), stdvec5.end());
+  EXPECT_EQ(compare_to_std(stdvec5, s21vec5, true), true);
+  s21vec5.resize(10);
+  stdvec5.resize(10);
+  EXPECT_EQ(compare_to_std(stdvec5, s21vec5, true), true);
+
+  std::vector<throw_tester_class> stdvec6(10);
+  stdvec6[5].n = 1;
+  bool catched = false;
+  try {
+    s21::vector<throw_tester_class> s21vec6(stdvec6.begin(), stdvec6.end());
+  } catch (...) {
+    catched = true;
+  }
+  EXPECT_EQ(catched, true);
+  catched = false;
+
+  try {
+    s21::vector<throw_tester_class> s21vec7(10, stdvec6[5]);
+  } catch (...) {
+    catched = true;
+  }
+  EXPECT_EQ(catched, true);
+  catched = false;
+
+  s21::vector<throw_tester_class> s21vec8(3);
+  try {
+    s21vec8.resize(10, stdvec6[5]);
+  } catch (...) {
+    catched = true;
+  }
+  EXPECT_EQ(catched, true);
+  EXPECT_EQ(s21vec8.size(), 3U);
+}
+
+template <class GrowthPolicy>
+std::vector<size_t> capacity_steps(int count) {
+  std::vector<size_t> steps;
+  s21::vector<int, std::allocator<int>, GrowthPolicy> s21vec;
+  for (int i = 0; i < count; ++i) {
+    s21vec.push_back(i);
+    if (steps.empty() || steps.back() != s21vec.capacity())
+      steps.push_back(s21vec.capacity());
+  }
+  return steps;
+}
+
+TEST(vector, growth_policy) {
+  EXPECT_EQ(capacity_steps<s21::doubling_growth>(20),
+            std::vector<size_t>({1, 2, 4, 8, 16, 32}));
+  EXPECT_EQ(capacity_steps<s21::one_and_half_growth>(20),
+            std::vector<size_t>({1, 2, 3, 4, 6, 9, 13, 19, 28}));
+  EXPECT_EQ(capacity_steps<s21::size_class_growth<>>(20),
+            std::vector<size_t>({4, 8, 12, 20}));
+  EXPECT_EQ(capacity_steps<s21::capped_growth<64>>(80),
+            std::vector<size_t>({1, 2, 4, 8, 16, 32, 48, 64, 80}));
+
+  EXPECT_EQ(s21::size_class_growth<>::round_to_size_class(100), 112U);
+  EXPECT_EQ(s21::size_class_growth<>::round_to_size_class(5000), 8192U);
+
+  s21::vector<double, std::allocator<double>, s21::one_and_half_growth>
+      s21vec1(10, 1.0);
+  s21vec1.insert(s21vec1.begin() + 5, 2.0);
+  EXPECT_EQ(s21vec1.capacity(), 15U);
+  s21vec1.insert(s21vec1.begin(), 20, 3.0);
+  EXPECT_EQ(s21vec1.capacity(), 31U);
+  EXPECT_EQ(s21vec1[25], 2.0);
+}
+
+TEST(vector, realloc_allocator) {
+  static_assert(s21::allocator_has_reallocate_v<s21::realloc_allocator<int>>);
+  static_assert(s21::allocator_has_try_expand_v<s21::realloc_allocator<int>>);
+  static_assert(!s21::allocator_has_reallocate_v<std::allocator<int>>);
+
+  s21::vector<int, s21::realloc_allocator<int, 4096>> s21vec1;
+  for (int i = 0; i < 100000; ++i) s21vec1.push_back(i);
+  EXPECT_EQ(s21vec1.size(), 100000U);
+  EXPECT_EQ(s21vec1.capacity(), 131072U);
+  for (int i = 0; i < 100000; ++i) EXPECT_EQ(s21vec1[i], i);
+  s21vec1.resize(10);
+  s21vec1.shrink_to_fit();
+  EXPECT_EQ(s21vec1.capacity(), 10U);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(s21vec1[i], i);
+
+  s21::vector<std::string, s21::realloc_allocator<std::string, 4096>>
+      s21vec2;
+  for (int i = 0; i < 1000; ++i) s21vec2.push_back(std::to_string(i));
+  s21vec2.insert(s21vec2.begin(), "first");
+  EXPECT_EQ(s21vec2[0], "first");
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(s21vec2[i + 1], std::to_string(i));
+
+  s21::realloc_allocator<char, 4096> alloc;
+  char *block = alloc.allocate(8192);
+  block[0] = 'a';
+  block = alloc.reallocate(block, 8192, 1 << 20);
+  EXPECT_EQ(block[0], 'a');
+  alloc.deallocate(block, 1 << 20);
+}
+
+TEST(vector, mmap_allocator) {
+  s21::vector<double, s21::mmap_allocator<double>> s21vec1(1 << 20, 1.5);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21vec1.data()) % (2 << 20), 0U);
+  s21vec1.push_back(2.5);
+  EXPECT_EQ(s21vec1[1 << 20], 2.5);
+  EXPECT_EQ(s21vec1[(1 << 20) - 1], 1.5);
+
+  s21::vector<double, s21::mmap_allocator<double, s21::huge_pages::hugetlb>>
+      s21vec2(s21vec1.begin(), s21vec1.end());
+  EXPECT_EQ(s21vec2.size(), s21vec1.size());
+  EXPECT_EQ(s21vec2.back(), 2.5);
+
+  s21::vector<int, s21::mmap_allocator<int, s21::huge_pages::none>> s21vec3;
+  for (int i = 0; i < 1000000; ++i) s21vec3.push_back(i);
+  for (int i = 0; i < 1000000; ++i) EXPECT_EQ(s21vec3[i], i);
+  s21vec3.resize(5);
+  s21vec3.shrink_to_fit();
+  EXPECT_EQ(s21vec3.capacity(), 5U);
+}
+
+TEST(vector, arena_allocator) {
+  alignas(std::max_align_t) char buffer[1024];
+  s21::arena arena(buffer, sizeof(buffer));
+  s21::arena_allocator<int> alloc(arena);
+  s21::vector<int, s21::arena_allocator<int>> s21vec1(alloc);
+  for (int i = 0; i < 100; ++i) s21vec1.push_back(i);
+  EXPECT_EQ(s21vec1.data() >= reinterpret_cast<int *>(buffer), true);
+  EXPECT_EQ(s21vec1.data() < reinterpret_cast<int *>(buffer + 1024), true);
+  EXPECT_EQ(arena.bytes_reserved(), 0U);
+
+  s21::vector<std::string, s21::arena_allocator<std::string>> s21vec2(
+      {"alpha", "beta", "gamma", "delta"}, arena);
+  for (int i = 0; i < 100; ++i) s21vec2.push_back(std::to_string(i));
+  EXPECT_EQ(arena.bytes_reserved() > 0, true);
+  EXPECT_EQ(s21vec2[2], "gamma");
+  EXPECT_EQ(s21vec2.back(), "99");
+
+  s21::arena other_arena;
+  s21::vector<std::string, s21::arena_allocator<std::string>> s21vec3(
+      other_arena);
+  s21vec3 = s21vec2;
+  EXPECT_EQ(s21vec3.get_allocator().resource(), &other_arena);
+  EXPECT_EQ(s21vec3.size(), s21vec2.size());
+  s21vec3 = std::move(s21vec2);
+  EXPECT_EQ(s21vec3.get_allocator().resource(), &other_arena);
+  EXPECT_EQ(s21vec3[1], "beta");
+  EXPECT_EQ(s21vec2.empty(), true);
+
+  s21::vector<std::string, s21::arena_allocator<std::string>> s21vec4(
+      std::move(s21vec3), arena);
+  EXPECT_EQ(s21vec4.get_allocator().resource(), &arena);
+  EXPECT_EQ(s21vec4.size(), 104U);
+  EXPECT_EQ(s21vec3.empty(), true);
+
+  s21::arena scratch;
+  for (int request = 0; request < 3; ++request) {
+    {
+      s21::vector<int, s21::arena_allocator<int>> s21vec5(1000, 1, scratch);
+      int *data = s21vec5.data();
+      s21vec5.resize(2000, 2);
+      EXPECT_EQ(s21vec5.data(), data);
+      EXPECT_EQ(s21vec5[1999], 2);
+    }
+    std::size_t reserved = scratch.bytes_reserved();
+    scratch.release();
+    EXPECT_EQ(scratch.bytes_reserved() <= reserved, true);
+  }
+}
+
+TEST(vector, polymorphic_allocator) {
+  using pmr_vector =
+      s21::vector<std::string, std::pmr::polymorphic_allocator<std::string>>;
+  std::pmr::monotonic_buffer_resource resource1;
+  s21::arena resource2;
+  pmr_vector s21vec1({"a", "b", "c"}, &resource1);
+  pmr_vector s21vec2(&resource2);
+  s21vec2 = s21vec1;
+  EXPECT_EQ(s21vec2.get_allocator().resource(), &resource2);
+  s21vec2.push_back("d");
+  s21vec1 = std::move(s21vec2);
+  EXPECT_EQ(s21vec1.get_allocator().resource(), &resource1);
+  EXPECT_EQ(s21vec1.size(), 4U);
+  EXPECT_EQ(s21vec1[3], "d");
+
+  pmr_vector s21vec3(s21vec1);
+  EXPECT_EQ(s21vec3.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  pmr_vector s21vec4(std::move(s21vec1), &resource2);
+  EXPECT_EQ(s21vec4.get_allocator().resource(), &resource2);
+  pmr_vector s21vec5({"e"}, &resource2);
+  s21vec5.swap(s21vec4);
+  EXPECT_EQ(s21vec5.size(), 4U);
+  EXPECT_EQ(s21vec5[0], "a");
+  EXPECT_EQ(s21vec4[0], "e");
+}
+
+TEST(vector, emplace_back_uses_allocator) {
+  using pmr_vector =
+      s21::vector<std::pmr::string,
+                  std::pmr::polymorphic_allocator<std::pmr::string>>;
+  std::pmr::monotonic_buffer_resource resource;
+  pmr_vector s21vec1(&resource);
+  std::pmr::memory_resource *previous =
+      std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  EXPECT_NO_THROW({
+    for (int i = 0; i < 10; ++i)
+      s21vec1.emplace_back("long enough to live on the heap");
+    s21vec1.shrink_to_fit();
+    s21vec1.emplace_back(s21vec1[0]);
+    s21vec1.emplace_back_n(20, "another string that lives on the heap");
+  });
+  std::pmr::set_default_resource(previous);
+  ASSERT_EQ(s21vec1.size(), 31U);
+  EXPECT_EQ(s21vec1[10], "long enough to live on the heap");
+  EXPECT_EQ(s21vec1[30], "another string that lives on the heap");
+  EXPECT_EQ(s21vec1[30].get_allocator().resource(), &resource);
+}
+
+TEST(vector, assignment_reuses_capacity) {
+  std::vector<std::string> stdvec1(10, "long enough to live on the heap");
+  std::vector<std::string> stdvec2(3, "short");
+  s21::vector<std::string> s21vec1(10, "long enough to live on the heap");
+  s21::vector<std::string> s21vec2(3, "short");
+  const std::string *data = s21vec1.data();
+  stdvec1 = stdvec2;
+  s21vec1 = s21vec2;
+  EXPECT_EQ(compare_to_std(stdvec1, s21vec1, true), true);
+  EXPECT_EQ(s21vec1.data(), data);
+
+  stdvec2.assign(7, "seven");
+  s21vec2.assign(7, "seven");
+  EXPECT_EQ(compare_to_std(stdvec2, s21vec2, true), true);
+  stdvec1 = stdvec2;
+  s21vec1 = s21vec2;
+  EXPECT_EQ(compare_to_std(stdvec1, s21vec1, true), true);
+  EXPECT_EQ(s21vec1.data(), data);
+
+  stdvec2.resize(25, "tail");
+  s21vec2.resize(25, "tail");
+  stdvec1 = stdvec2;
+  s21vec1 = s21vec2;
+  EXPECT_EQ(compare_to_std(stdvec1, s21vec1, true), true);
+  EXPECT_EQ(s21vec1.capacity(), 25U);
+
+  stdvec1 = {"a", "b"};
+  s21vec1 = {"a", "b"};
+  EXPECT_EQ(compare_to_std(stdvec1, s21vec1, true), true);
+
+  using pmr_vector =
+      s21::vector<std::string, std::pmr::polymorphic_allocator<std::string>>;
+  std::pmr::monotonic_buffer_resource resource1;
+  std::pmr::monotonic_buffer_resource resource2;
+  pmr_vector s21vec3({"x", "y", "z"}, &resource1);
+  pmr_vector s21vec4(&resource2);
+  s21vec4.reserve(8);
+  const std::string *pmr_data = s21vec4.data();
+  s21vec4 = std::move(s21vec3);
+  EXPECT_EQ(s21vec4.data(), pmr_data);
+  EXPECT_EQ(s21vec4.size(), 3U);
+  EXPECT_EQ(s21vec4[2], "z");
+  EXPECT_EQ(s21vec3.empty(), true);
+
+  s21vec4 = std::move(s21vec4);
+  EXPECT_EQ(s21vec4.size(), 3U);
+}
+
+TEST(vector, copy_construction_fits_size) {
+  std::vector<int> stdvec1;
+  s21::vector<int> s21vec1;
+  stdvec1.reserve(1000);
+  s21vec1.reserve(1000);
+  for (int i = 0; i < 33; ++i) {
+    stdvec1.push_back(i);
+    s21vec1.push_back(i);
+  }
+  std::vector<int> stdvec2(stdvec1);
+  s21::vector<int> s21vec2(s21vec1);
+  EXPECT_EQ(compare_to_std(stdvec2, s21vec2, true), true);
+  EXPECT_EQ(s21vec2.capacity(), 33U);
+
+  s21::vector<int> s21vec3(s21vec1, s21vec1.get_allocator());
+  EXPECT_EQ(s21vec3.capacity(), 33U);
+  EXPECT_EQ(s21vec3[32], 32);
+
+  s21::vector<std::string> s21vec4(5, "string");
+  s21vec4.reserve(64);
+  s21vec4.erase(s21vec4.begin() + 1, s21vec4.end());
+  s21::vector<std::string> s21vec5(s21vec4);
+  EXPECT_EQ(s21vec5.capacity(), 1U);
+  EXPECT_EQ(s21vec5[0], "string");
+
+  s21::vector<int> s21vec6;
+  s21vec6.reserve(10);
+  s21::vector<int> s21vec7(s21vec6);
+  EXPECT_EQ(s21vec7.capacity(), 0U);
+  EXPECT_EQ(s21vec7.data(), nullptr);
+}
+
+TEST(vector, bulk_append) {
+  s21::vector<int> s21vec1 = {1, 2};
+  std::vector<int> stdvec1 = {1, 2};
+  auto same_elements = [&s21vec1, &stdvec1] {
+    return std::equal(s21vec1.begin(), s21vec1.end(), stdvec1.begin(),
+                      stdvec1.end());
+  };
+  std::vector<int> source = {3, 4, 5, 6, 7};
+  s21vec1.append(source.begin(), source.end());
+  stdvec1.insert(stdvec1.end(), source.begin(), source.end());
+  EXPECT_EQ(same_elements(), true);
+  std::list<int> list = {8, 9};
+  s21vec1.append(list.begin(), list.end());
+  stdvec1.insert(stdvec1.end(), list.begin(), list.end());
+  EXPECT_EQ(same_elements(), true);
+  std::istringstream input("10 11 12");
+  s21vec1.append(std::istream_iterator<int>(input),
+                 std::istream_iterator<int>());
+  stdvec1.insert(stdvec1.end(), {10, 11, 12});
+  EXPECT_EQ(same_elements(), true);
+  s21vec1.shrink_to_fit();
+  s21vec1.append(s21vec1.begin() + 1, s21vec1.end());
+  EXPECT_EQ(s21vec1.size(), 23U);
+  stdvec1.reserve(stdvec1.size() * 2);
+  stdvec1.insert(stdvec1.end(), stdvec1.begin() + 1, stdvec1.end());
+  EXPECT_EQ(same_elements(), true);
+  s21vec1.emplace_back_n(3, 42);
+  stdvec1.insert(stdvec1.end(), 3, 42);
+  EXPECT_EQ(same_elements(), true);
+  s21vec1.reserve(s21vec1.size() + 2);
+  int value = 7;
+  s21vec1.push_back_unchecked(value);
+  s21vec1.push_back_unchecked(8);
+  stdvec1.push_back(7);
+  stdvec1.push_back(8);
+  EXPECT_EQ(same_elements(), true);
+}
+
+TEST(vector, bulk_append_aliasing) {
+  s21::vector<std::string> s21vec1 = {"first", "second"};
+  s21vec1.shrink_to_fit();
+  s21vec1.push_back(s21vec1[0]);
+  EXPECT_EQ(s21vec1[2], "first");
+  s21vec1.shrink_to_fit();
+  s21vec1.emplace_back_n(2, s21vec1[1]);
+  EXPECT_EQ(s21vec1.size(), 5U);
+  EXPECT_EQ(s21vec1[4], "second");
+  s21vec1.shrink_to_fit();
+  s21vec1.append(s21vec1.begin(), s21vec1.begin() + 3);
+  EXPECT_EQ(s21vec1.size(), 8U);
+  EXPECT_EQ(s21vec1[5], "first");
+  EXPECT_EQ(s21vec1[7], "first");
+  s21::vector<std::string> s21vec3 = {"a", "b"};
+  s21vec3.shrink_to_fit();
+  s21vec3.append(s21vec3.rbegin(), s21vec3.rend());
+  std::vector<std::string> expected = {"a", "b", "b", "a"};
+  EXPECT_EQ(std::equal(expected.begin(), expected.end(), s21vec3.begin(),
+                       s21vec3.end()),
+            true);
+  s21vec3.shrink_to_fit();
+  s21vec3.append(s21vec3.cbegin() + 1, s21vec3.cend());
+  EXPECT_EQ(s21vec3.size(), 7U);
+  EXPECT_EQ(s21vec3[6], "a");
+  s21::vector<int> s21vec4 = {1, 2, 3};
+  s21vec4.shrink_to_fit();
+  s21vec4.append(s21vec4.begin(), s21vec4.end());
+  EXPECT_EQ(s21vec4[5], 3);
+  s21::vector<std::string> s21vec2;
+  s21vec2.emplace_back_n(0, "unused");
+  EXPECT_EQ(s21vec2.capacity(), 0U);
+}
+
+TEST(vector, default_init) {
+  s21::vector<int> s21vec1(4, s21::default_init);
+  EXPECT_EQ(s21vec1.size(), 4U);
+  EXPECT_EQ(s21vec1.capacity(), 4U);
+  for (int i = 0; i < 4; ++i) s21vec1[i] = i;
+
+  std::vector<int> stdvec1 = {0, 1, 2, 3};
+  stdvec1.resize(100);
+  s21vec1.resize_for_overwrite(100);
+  EXPECT_EQ(s21vec1.size(), stdvec1.size());
+  EXPECT_EQ(s21vec1.capacity(), stdvec1.capacity());
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(s21vec1[i], i);
+
+  s21vec1.resize(2, s21::default_init);
+  stdvec1.resize(2);
+  EXPECT_EQ(compare_to_std(stdvec1, s21vec1, true), true);
+
+  std::vector<std::string> stdvec2(3);
+  s21::vector<std::string> s21vec2(3, s21::default_init);
+  EXPECT_EQ(compare_to_std(stdvec2, s21vec2, true), true);
+  stdvec2.resize(7);
+  s21vec2.resize_for_overwrite(7);
+  EXPECT_EQ(compare_to_std(stdvec2, s21vec2, true), true);
+}
+
+TEST(vector, aligned_allocator) {
+  std::vector<float, s21::aligned_allocator<float, 64>> stdvec1;
+  s21::vector<float, s21::aligned_allocator<float, 64>> s21vec1;
+  s21::vector<double, s21::aligned_allocator<double, 32>> s21vec2(7, 1.5);
+  for (int i = 0; i < 100; ++i) {
+    stdvec1.push_back(i);
+    s21vec1.push_back(i);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21vec1.data()) % 64, 0U);
+  }
+  EXPECT_EQ(compare_to_std(stdvec1, s21vec1, true), true);
+  s21vec1.shrink_to_fit();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21vec1.data()) % 64, 0U);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21vec2.data()) % 32, 0U);
+  EXPECT_EQ(s21vec2[6], 1.5);
+  EXPECT_EQ(
+      (s21::allocator_alignment_v<s21::aligned_allocator<float, 64>>), 64U);
+  EXPECT_EQ(s21::allocator_alignment_v<std::allocator<double>>,
+            alignof(double));
+}
+
+template <class T>
+void check_middle_insert_erase(const std::vector<T> &values) {
+  std::vector<T> stdvec(values.begin(), values.end());
+  s21::vector<T> s21vec(values.begin(), values.end());
+  stdvec.reserve(64);
+  s21vec.reserve(64);
+  stdvec.insert(stdvec.begin() + 3, 2, values[0]);
+  s21vec.insert(s21vec.begin() + 3, 2, values[0]);
+  EXPECT_EQ(compare_to_std(stdvec, s21vec, true), true);
+  stdvec.insert(stdvec.end() - 1, values.begin(), values.end());
+  s21vec.insert(s21vec.end() - 1, values.begin(), values.end());
+  EXPECT_EQ(compare_to_std(stdvec, s21vec, true), true);
+  stdvec.insert(stdvec.begin() + 1, values[1]);
+  s21vec.insert(s21vec.begin() + 1, values[1]);
+  EXPECT_EQ(compare_to_std(stdvec, s21vec, true), true);
+  stdvec.erase(stdvec.begin() + 2, stdvec.begin() + 9);
+  s21vec.erase(s21vec.begin() + 2, s21vec.begin() + 9);
+  EXPECT_EQ(compare_to_std(stdvec, s21vec, true), true);
+  stdvec.erase(stdvec.begin());
+  s21vec.erase(s21vec.begin());
+  stdvec.erase(stdvec.end() - 1);
+  s21vec.erase(s21vec.end() - 1);
+  stdvec.erase(stdvec.begin() + 1, stdvec.begin() + 1);
+  s21vec.erase(s21vec.begin() + 1, s21vec.begin() + 1);
+  EXPECT_EQ(compare_to_std(stdvec, s21vec, true), true);
+}
+
+TEST(vector, middle_insert_erase) {
+  check_middle_insert_erase<int>({1, 2, 3, 4, 5, 6, 7, 8});
+  check_middle_insert_erase<std::string>(
+      {"one", "two", "three", "four", "five", "six", "seven", "eight"});
+  std::vector<std::string> long_strings;
+  for (int i = 0; i < 8; ++i)
+    long_strings.push_back(std::string(40, static_cast<char>('a' + i)));
+  check_middle_insert_erase(long_strings);
+
+  s21::vector<std::unique_ptr<int>> s21vec;
+  for (int i = 0; i < 6; ++i) s21vec.emplace_back(new int(i));
+  s21vec.erase(s21vec.begin() + 1, s21vec.begin() + 3);
+  s21vec.emplace(s21vec.begin() + 2, new int(10));
+  EXPECT_EQ(s21vec.size(), 5U);
+  int expected[] = {0, 3, 10, 4, 5};
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(*s21vec[i], expected[i]);
+}
+
+struct stats_test_tag {
+  static constexpr const char *name = "stats_test";
+};
+
+struct copy_only_value {
+  explicit copy_only_value(int value) : value(value) {}
+  copy_only_value(const copy_only_value &other) : value(other.value) {}
+  int value;
+};
+
+TEST(vector, stats) {
+  using counted_vector =
+      s21::vector<std::string, std::allocator<std::string>,
+                  s21::doubling_growth,
+                  s21::counting_vector_stats<stats_test_tag>>;
+  {
+    counted_vector s21vec1;
+    for (int i = 0; i < 100; ++i) s21vec1.push_back(std::to_string(i));
+    s21::vector_counters counters = s21vec1.stats();
+    EXPECT_EQ(counters.reallocations, 7U);
+    EXPECT_EQ(counters.elements_moved, 127U);
+    EXPECT_EQ(counters.elements_copied, 0U);
+    EXPECT_EQ(counters.peak_capacity, 128U);
+    EXPECT_EQ(counters.wasted_capacity, 28U);
+    s21vec1.insert(s21vec1.begin(), "x");
+    s21vec1.erase(s21vec1.begin() + 50);
+    EXPECT_EQ(s21vec1.stats().elements_moved, 127U + 100U + 50U);
+  }
+  EXPECT_EQ(s21::vector<int>().stats().reallocations, 0U);
+
+  s21::vector<copy_only_value, std::allocator<copy_only_value>,
+              s21::doubling_growth, s21::counting_vector_stats<>>
+      s21vec2;
+  for (int i = 0; i < 4; ++i) s21vec2.emplace_back(i);
+  EXPECT_EQ(s21vec2.stats().elements_copied, 1U + 2U);
+  EXPECT_EQ(s21vec2.stats().elements_moved, 0U);
+
+  std::ostringstream dump;
+  s21::dump_vector_stats(dump);
+  EXPECT_NE(dump.str().find("s21_vector_reallocations{tag=\"stats_test\"} 7\n"),
+            std::string::npos);
+  EXPECT_NE(dump.str().find("s21_vector_wasted_bytes{tag=\"stats_test\"} " +
+                            std::to_string(28 * sizeof(std::string))),
+            std::string::npos);
+}
+
+// small_vector tests
+
+TEST(small_vector, inline_storage) {
+  s21::small_vector<int, 16> s21vec1;
+  EXPECT_EQ(s21vec1.capacity(), 16U);
+  EXPECT_EQ(s21vec1.is_inline(), true);
+  for (int i = 0; i < 16; ++i) s21vec1.push_back(i);
+  EXPECT_EQ(s21vec1.is_inline(), true);
+  s21vec1.push_back(16);
+  EXPECT_EQ(s21vec1.is_inline(), false);
+  EXPECT_EQ(s21vec1.capacity(), 32U);
+  for (int i = 0; i < 17; ++i) EXPECT_EQ(s21vec1[i], i);
+
+  s21vec1.resize(10);
+  s21vec1.shrink_to_fit();
+  EXPECT_EQ(s21vec1.is_inline(), true);
+  EXPECT_EQ(s21vec1.capacity(), 16U);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(s21vec1[i], i);
+
+  s21::small_vector<std::string, 4> s21vec2({"a", "b", "c"});
+  s21vec2.insert(s21vec2.begin() + 1, "d");
+  s21vec2.emplace(s21vec2.begin(), 3, 'e');
+  EXPECT_EQ(s21vec2.is_inline(), false);
+  s21::small_vector<std::string, 4>::iterator it = s21vec2.begin();
+  EXPECT_EQ(*it, "eee");
+  EXPECT_EQ(*++it, "a");
+  EXPECT_EQ(*++it, "d");
+  EXPECT_EQ(s21vec2.back(), "c");
+  EXPECT_EQ(s21vec2.get_allocator(), std::allocator<std::string>());
+
+  using inline_vector = s21::vector<
+      int, s21::small_vector_allocator<int, 16, std::allocator<int>>>;
+  static_assert(!std::is_convertible_v<s21::small_vector<int, 16> &,
+                                       inline_vector &>);
+}
+
+TEST(small_vector, copy_and_move) {
+  s21::small_vector<std::string, 4> s21vec1(3, "inline");
+  s21::small_vector<std::string, 4> s21vec2(10, "heap");
+
+  s21::small_vector<std::string, 4> s21vec3(s21vec1);
+  EXPECT_EQ(s21vec3.is_inline(), true);
+  EXPECT_EQ(s21vec3.size(), 3U);
+  EXPECT_EQ(s21vec3[2], "inline");
+
+  s21::small_vector<std::string, 4> s21vec4(std::move(s21vec3));
+  EXPECT_EQ(s21vec4.is_inline(), true);
+  EXPECT_EQ(s21vec4.size(), 3U);
+  EXPECT_EQ(s21vec3.size(), 0U);
+
+  const std::string *heap_data = s21vec2.data();
+  s21::small_vector<std::string, 4> s21vec5(std::move(s21vec2));
+  EXPECT_EQ(s21vec5.data(), heap_data);
+  EXPECT_EQ(s21vec2.is_inline(), true);
+  EXPECT_EQ(s21vec2.size(), 0U);
+
+  s21vec2 = s21vec5;
+  EXPECT_EQ(s21vec2.size(), 10U);
+  s21vec4 = std::move(s21vec5);
+  EXPECT_EQ(s21vec4.data(), heap_data);
+  EXPECT_EQ(s21vec4[9], "heap");
+
+  s21vec1.swap(s21vec4);
+  EXPECT_EQ(s21vec1.data(), heap_data);
+  EXPECT_EQ(s21vec4.size(), 3U);
+  EXPECT_EQ(s21vec4[0], "inline");
+
+  s21vec4 = {"x", "y"};
+  EXPECT_EQ(s21vec4.size(), 2U);
+  EXPECT_EQ(s21vec4[1], "y");
+
+  using string_small_vector = s21::small_vector<std::string, 4>;
+  using arena_small_vector =
+      s21::small_vector<int, 4, s21::arena_allocator<int>>;
+  EXPECT_EQ(std::is_nothrow_move_assignable_v<string_small_vector>, true);
+  EXPECT_EQ(std::is_nothrow_move_assignable_v<arena_small_vector>, false);
+}
+
+TEST(small_vector, vector_conversion) {
+  s21::vector<int> s21vec1(100, 7);
+  const int *heap_data = s21vec1.data();
+  s21::small_vector<int, 8> s21vec2(std::move(s21vec1));
+  EXPECT_EQ(s21vec2.data(), heap_data);
+  EXPECT_EQ(s21vec2.size(), 100U);
+  EXPECT_EQ(s21vec1.size(), 0U);
+
+  s21::vector<int> s21vec3 = std::move(s21vec2);
+  EXPECT_EQ(s21vec3.data(), heap_data);
+  EXPECT_EQ(s21vec3.size(), 100U);
+  EXPECT_EQ(s21vec2.is_inline(), true);
+
+  s21::small_vector<int, 8> s21vec4({1, 2, 3});
+  s21::vector<int> s21vec5 = s21vec4;
+  s21::vector<int> s21vec6 = std::move(s21vec4);
+  EXPECT_EQ(s21vec5.size(), 3U);
+  EXPECT_EQ(s21vec6.size(), 3U);
+  EXPECT_EQ(s21vec6[2], 3);
+
+  s21vec4 = std::move(s21vec3);
+  EXPECT_EQ(s21vec4.data(), heap_data);
+}
+
+// soa_vector tests
+
+TEST(soa_vector, rows_and_columns) {
+  s21::soa_vector<int, std::string, double> s21soa1;
+  EXPECT_EQ(s21soa1.empty(), true);
+  s21soa1.push_back({1, "one", 1.5});
+  std::tuple<int, std::string, double> row(2, "two", 2.5);
+  s21soa1.push_back(row);
+  s21soa1.emplace_back(3, std::string(3, 'x'), 3.5);
+  EXPECT_EQ(s21soa1.size(), 3U);
+  EXPECT_EQ(std::get<1>(s21soa1[1]), "two");
+  EXPECT_EQ(std::get<1>(s21soa1.back()), "xxx");
+  EXPECT_EQ(std::get<0>(s21soa1.front()), 1);
+  EXPECT_THROW(s21soa1.at(3), std::out_of_range);
+
+  auto [id, name, weight] = s21soa1[0];
+  id = 10;
+  name = "ten";
+  EXPECT_EQ(std::get<0>(s21soa1.at(0)), 10);
+  EXPECT_EQ(std::get<1>(s21soa1.at(0)), "ten");
+  EXPECT_EQ(weight, 1.5);
+
+  s21::span<double> weights = s21soa1.column<2>();
+  EXPECT_EQ(weights.size(), 3U);
+  for (double &value : weights) value *= 2;
+  const auto &s21soa2 = s21soa1;
+  s21::span<const double> const_weights = s21soa2.column<2>();
+  EXPECT_EQ(const_weights[1], 5.0);
+  EXPECT_EQ(const_weights.back(), 7.0);
+
+  int id_sum = 0;
+  double weight_sum = 0;
+  for (auto [row_id, row_name, row_weight] : s21soa2) {
+    id_sum += row_id;
+    weight_sum += row_weight;
+    EXPECT_EQ(row_name.empty(), false);
+  }
+  EXPECT_EQ(id_sum, 15);
+  EXPECT_EQ(weight_sum, 15.0);
+  EXPECT_EQ(s21soa1.end() - s21soa1.begin(), 3);
+  EXPECT_EQ(std::get<0>(*(s21soa1.cbegin() + 2)), 3);
+
+  s21soa1.pop_back();
+  EXPECT_EQ(s21soa1.size(), 2U);
+  s21soa1.reserve(100);
+  EXPECT_EQ(s21soa1.capacity(), 100U);
+  s21soa1.resize(5);
+  EXPECT_EQ(std::get<1>(s21soa1[4]), "");
+  s21soa1.shrink_to_fit();
+  EXPECT_EQ(s21soa1.capacity(), 5U);
+
+  s21::soa_vector<int, std::string, double> s21soa3 = {{7, "seven", 7.0}};
+  s21soa3.swap(s21soa1);
+  EXPECT_EQ(s21soa1.size(), 1U);
+  EXPECT_EQ(s21soa3.size(), 5U);
+  s21soa3.clear();
+  EXPECT_EQ(s21soa3.empty(), true);
+}
+
+TEST(soa_vector, allocator_and_growth) {
+  using aligned = s21::aligned_allocator<std::tuple<float, double>, 64>;
+  s21::basic_soa_vector<aligned, s21::one_and_half_growth, float, double>
+      s21soa1;
+  s21::vector<float, s21::aligned_allocator<float, 64>,
+              s21::one_and_half_growth>
+      s21vec1;
+  for (int i = 0; i < 100; ++i) {
+    s21soa1.emplace_back(float(i), i * 2.0);
+    s21vec1.push_back(float(i));
+    EXPECT_EQ(s21soa1.capacity(), s21vec1.capacity());
+  }
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21soa1.column<0>().data()) % 64,
+            0U);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s21soa1.column<1>().data()) % 64,
+            0U);
+  EXPECT_EQ(s21soa1.get_allocator() == aligned(), true);
+
+  auto first = s21soa1.begin();
+  auto last = s21soa1.cend();
+  EXPECT_EQ(last > first, true);
+  EXPECT_EQ(first >= last, false);
+  EXPECT_EQ(first <= first, true);
+  EXPECT_EQ(std::get<1>(*(3 + first)), 6.0);
+  EXPECT_EQ(std::get<0>(first[99]), 99.0f);
+}
+
+TEST(soa_vector, strong_push_back) {
+  s21::soa_vector<int, throw_tester_class> s21soa1(2);
+  throw_tester_class value;
+  value.n = 1;
+  EXPECT_THROW(s21soa1.emplace_back(1, value), std::out_of_range);
+  EXPECT_EQ(s21soa1.size(), 2U);
+  EXPECT_EQ(s21soa1.column<0>().size(), 2U);
+}
+
+// mapped_vector tests
+
+struct mapped_record {
+  std::int64_t key;
+  double value;
+};
+
+TEST(mapped_vector, write_and_reload) {
+  std::string path = testing::TempDir() + "s21_mapped_vector_test.bin";
+  std::remove(path.c_str());
+  {
+    s21::mapped_vector<mapped_record> s21vec1(path, s21::map_mode::read_write);
+    EXPECT_EQ(s21vec1.is_open(), true);
+    EXPECT_EQ(s21vec1.empty(), true);
+    for (int i = 0; i < 1000; ++i) s21vec1.push_back({i, i * 0.5});
+    s21vec1.emplace_back(mapped_record{1000, 500.0});
+    EXPECT_EQ(s21vec1.size(), 1001U);
+    EXPECT_GE(s21vec1.capacity(), 1001U);
+    s21vec1.pop_back();
+    s21vec1.sync();
+  }
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  EXPECT_EQ(static_cast<std::size_t>(file.tellg()),
+            s21::mapped_vector<mapped_record>::file_header_size +
+                1000 * sizeof(mapped_record));
+  file.close();
+
+  s21::mapped_vector<mapped_record> s21vec2(path);
+  s21vec2.advise(s21::access_advice::sequential);
+  s21vec2.advise(s21::access_advice::willneed);
+  EXPECT_EQ(s21vec2.size(), 1000U);
+  EXPECT_EQ(s21vec2.capacity(), 1000U);
+  std::int64_t key_sum = 0;
+  for (const mapped_record &record : s21vec2) key_sum += record.key;
+  EXPECT_EQ(key_sum, 999 * 1000 / 2);
+  EXPECT_EQ(s21vec2.at(10).value, 5.0);
+  EXPECT_EQ(s21vec2.back().key, 999);
+  EXPECT_THROW(s21vec2.at(1000), std::out_of_range);
+  EXPECT_THROW(s21vec2.push_back({0, 0}), std::logic_error);
+  s21vec2.front().key = -1;
+  s21vec2.close();
+  EXPECT_EQ(s21vec2.is_open(), false);
+
+  s21::mapped_vector<mapped_record> s21vec3(path, s21::map_mode::read_write);
+  EXPECT_EQ(s21vec3.front().key, 0);
+  s21vec3.resize(10);
+  s21vec3.resize(12, mapped_record{7, 7.0});
+  s21vec3.shrink_to_fit();
+  EXPECT_EQ(s21vec3.capacity(), 12U);
+  EXPECT_EQ(s21vec3[11].key, 7);
+  s21::mapped_vector<mapped_record> s21vec4(std::move(s21vec3));
+  EXPECT_EQ(s21vec3.is_open(), false);
+  EXPECT_EQ(s21vec4.size(), 12U);
+  s21vec4.clear();
+  s21vec4.close();
+
+  s21::mapped_vector<mapped_record> s21vec5(path);
+  EXPECT_EQ(s21vec5.empty(), true);
+  EXPECT_EQ(s21vec5.data(), nullptr);
+  s21vec5.close();
+  std::remove(path.c_str());
+}
+
+TEST(mapped_vector, size_survives_without_close) {
+  std::string path = testing::TempDir() + "s21_mapped_vector_crash.bin";
+  std::remove(path.c_str());
+  s21::mapped_vector<mapped_record> s21vec1(path, s21::map_mode::read_write);
+  for (int i = 0; i < 3; ++i) s21vec1.push_back({i, i * 0.5});
+  ASSERT_GT(s21vec1.capacity(), 3U);
+  s21::mapped_vector<mapped_record> s21vec2(path);
+  EXPECT_EQ(s21vec2.size(), 3U);
+  EXPECT_EQ(s21vec2.back().key, 2);
+  s21vec1.pop_back();
+  s21::mapped_vector<mapped_record> s21vec3(path);
+  EXPECT_EQ(s21vec3.size(), 2U);
+  s21vec1.close();
+  std::remove(path.c_str());
+}
+
+TEST(mapped_vector, bad_files) {
+  std::string path = testing::TempDir() + "s21_mapped_vector_odd.bin";
+  std::ofstream(path, std::ios::binary) << "odd";
+  EXPECT_THROW(s21::mapped_vector<mapped_record>{path}, std::runtime_error);
+  std::ofstream(path, std::ios::binary)
+      << std::string(s21::mapped_vector<mapped_record>::file_header_size +
+                         sizeof(mapped_record),
+                     '\0');
+  EXPECT_THROW(s21::mapped_vector<mapped_record>{path}, std::runtime_error);
+  std::remove(path.c_str());
+  EXPECT_THROW(s21::mapped_vector<mapped_record>{path}, std::system_error);
+}
+
+// binary image tests
+
+TEST(binary_io, pipe_round_trip) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  s21::vector<mapped_record> s21vec1;
+  for (int i = 0; i < 100; ++i) s21vec1.push_back({i, i * 0.25});
+  s21::array<std::uint16_t, 3> s21arr1 = {7, 8, 9};
+  s21::write_binary(fds[1], s21vec1);
+  s21::write_binary(fds[1], s21arr1);
+  s21::write_binary(fds[1], s21::vector<char>());
+  s21::write_binary(fds[1], s21arr1);
+  close(fds[1]);
+
+  s21::vector<mapped_record> s21vec2(5);
+  s21::read_binary(fds[0], s21vec2);
+  EXPECT_EQ(s21vec2.size(), 100U);
+  EXPECT_EQ(std::memcmp(s21vec2.data(), s21vec1.data(),
+                        100 * sizeof(mapped_record)),
+            0);
+  s21::array<std::uint16_t, 3> s21arr2 = {};
+  s21::read_binary(fds[0], s21arr2);
+  EXPECT_EQ(s21arr2 == s21arr1, true);
+  s21::vector<char> s21vec3(3);
+  s21::read_binary(fds[0], s21vec3);
+  EXPECT_EQ(s21vec3.empty(), true);
+  s21::vector<std::uint32_t> s21vec4(3);
+  EXPECT_THROW(s21::read_binary(fds[0], s21vec4), std::runtime_error);
+  EXPECT_THROW(s21::read_binary(fds[0], s21vec4), std::runtime_error);
+  close(fds[0]);
+}
+
+TEST(binary_io, multi_chunk_read) {
+  std::string path = testing::TempDir() + "s21_binary_io_chunks.bin";
+  s21::vector<std::uint32_t> s21vec1(2 * s21::binary_read_chunk);
+  for (std::size_t i = 0; i < s21vec1.size(); ++i)
+    s21vec1[i] = static_cast<std::uint32_t>(i * 2654435761U);
+  int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  ASSERT_NE(fd, -1);
+  s21::write_binary(fd, s21vec1);
+  close(fd);
+
+  s21::vector<std::uint32_t, std::allocator<std::uint32_t>,
+              s21::doubling_growth, s21::counting_vector_stats<>>
+      s21vec2;
+  fd = open(path.c_str(), O_RDONLY);
+  ASSERT_NE(fd, -1);
+  s21::read_binary(fd, s21vec2);
+  close(fd);
+  std::remove(path.c_str());
+  ASSERT_EQ(s21vec2.size(), s21vec1.size());
+  EXPECT_EQ(std::memcmp(s21vec2.data(), s21vec1.data(),
+                        s21vec1.size() * sizeof(std::uint32_t)),
+            0);
+  EXPECT_LE(s21vec2.stats().reallocations, 3U);
+}
+
+TEST(binary_io, untrusted_count) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  s21::vector<std::uint32_t> s21vec1 = {1, 2, 3};
+  s21::binary_header header = s21::make_binary_header(s21vec1.data(), 3);
+  header.count = std::uint64_t(1) << 40;
+  ASSERT_EQ(write(fds[1], &header, sizeof(header)),
+            static_cast<ssize_t>(sizeof(header)));
+  ASSERT_EQ(write(fds[1], s21vec1.data(), 12), 12);
+  close(fds[1]);
+  EXPECT_THROW(s21::read_binary(fds[0], s21vec1), std::runtime_error);
+  EXPECT_EQ(s21vec1.empty(), true);
+  close(fds[0]);
+
+  struct alignas(64) wide_record {
+    char bytes[64];
+  };
+  s21::vector<wide_record> s21vec2(1);
+  s21::binary_header wide_header =
+      s21::make_binary_header(s21vec2.data(), 1);
+  s21::vector<std::uint64_t, s21::aligned_allocator<std::uint64_t, 64>> buffer(
+      5);
+  std::memcpy(buffer.data(), &wide_header, sizeof(wide_header));
+  EXPECT_THROW(s21::view_binary<wide_record>(buffer.data(), 40, false),
+               std::runtime_error);
+}
+
+TEST(binary_io, view) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  s21::vector<double> s21vec1 = {1.5, 2.5, 3.5, 4.5, 5.5};
+  s21::write_binary(fds[1], s21vec1);
+  close(fds[1]);
+  std::size_t bytes = s21::binary_image_size<double>(5);
+  EXPECT_EQ(bytes, sizeof(s21::binary_header) + 5 * sizeof(double));
+  s21::vector<std::uint64_t> buffer(bytes / sizeof(std::uint64_t) + 1);
+  EXPECT_EQ(read(fds[0], buffer.data(), bytes + 1),
+            static_cast<ssize_t>(bytes));
+  close(fds[0]);
+
+  s21::span<const double> view = s21::view_binary<double>(buffer.data(), bytes);
+  EXPECT_EQ(static_cast<const void *>(view.data()),
+            static_cast<const void *>(buffer.data() + 4));
+  EXPECT_EQ(view.size(), 5U);
+  EXPECT_EQ(view.back(), 5.5);
+  EXPECT_THROW(s21::view_binary<double>(buffer.data(), bytes - 1),
+               std::runtime_error);
+  EXPECT_THROW(s21::view_binary<float>(buffer.data(), bytes),
+               std::runtime_error);
+  EXPECT_THROW(s21::view_binary<char>(buffer.data(), 8), std::runtime_error);
+  reinterpret_cast<unsigned char *>(buffer.data())[bytes - 1] ^= 1;
+  EXPECT_THROW(s21::view_binary<double>(buffer.data(), bytes),
+               std::runtime_error);
+  EXPECT_EQ(s21::view_binary<double>(buffer.data(), bytes, false).size(), 5U);
+}
+
+// incremental_vector tests
+
+TEST(incremental_vector, migration) {
+  s21::incremental_vector<int, std::allocator<int>, s21::one_and_half_growth,
+                          2>
+      s21vec1;
+  bool saw_migration = false;
+  for (int i = 0; i < 600; ++i) {
+    std::size_t capacity = s21vec1.capacity();
+    s21vec1.push_back(i);
+    if (s21vec1.capacity() != capacity && i > 1) {
+      EXPECT_EQ(s21vec1.migrating(), true);
+    }
+    saw_migration = saw_migration || s21vec1.migrating();
+    for (int j = 0; j <= i; ++j) ASSERT_EQ(s21vec1[j], j);
+  }
+  EXPECT_EQ(saw_migration, true);
+  EXPECT_EQ(s21vec1.size(), 600U);
+  EXPECT_EQ(s21vec1.at(599), 599);
+  EXPECT_THROW(s21vec1.at(600), std::out_of_range);
+  s21vec1.finish_migration();
+  EXPECT_EQ(s21vec1.migrating(), false);
+  s21vec1.reserve(5000);
+  EXPECT_EQ(s21vec1.capacity(), 5000U);
+  EXPECT_EQ(s21vec1.back(), 599);
+  EXPECT_EQ(std::accumulate(s21vec1.begin(), s21vec1.end(), 0),
+            599 * 600 / 2);
+}
+
+TEST(incremental_vector, non_trivial_elements) {
+  s21::incremental_vector<std::string> s21vec1 = {"a", "b"};
+  for (int i = 0; i < 31; ++i) s21vec1.emplace_back(i + 1, 'x');
+  EXPECT_EQ(s21vec1.migrating(), true);
+  EXPECT_EQ(s21vec1.front(), "a");
+  s21vec1.push_back(s21vec1[1]);
+  EXPECT_EQ(s21vec1.back(), "b");
+  while (s21vec1.size() > 10) s21vec1.pop_back();
+  EXPECT_EQ(s21vec1.migrating(), false);
+  EXPECT_EQ(s21vec1[9], "xxxxxxxx");
+  EXPECT_EQ(*s21vec1.rbegin(), "xxxxxxxx");
+
+  for (int i = 0; i < 40; ++i) s21vec1.push_back(std::to_string(i));
+  s21::incremental_vector<std::string> s21vec2(s21vec1);
+  EXPECT_EQ(s21vec2.size(), 50U);
+  EXPECT_EQ(s21vec2[49], "39");
+  s21::incremental_vector<std::string> s21vec3(std::move(s21vec1));
+  EXPECT_EQ(s21vec1.empty(), true);
+  EXPECT_EQ(s21vec3[0], "a");
+  s21vec1 = s21vec3;
+  s21vec3.clear();
+  s21vec3.swap(s21vec1);
+  EXPECT_EQ(s21vec3.size(), 50U);
+  EXPECT_EQ(s21vec1.empty(), true);
+  EXPECT_EQ(s21vec3.cend() - s21vec3.cbegin(), 50);
+}
+
+// segmented_vector tests
+
+TEST(segmented_vector, stable_growth) {
+  s21::segmented_vector<int, 16> s21vec1;
+  EXPECT_EQ(s21vec1.empty(), true);
+  EXPECT_EQ(s21vec1.capacity(), 0U);
+  const int &first = s21vec1.emplace_back(42);
+  const int *first_address = &first;
+  for (int i = 1; i < 1000; ++i) s21vec1.push_back(i);
+  EXPECT_EQ(&s21vec1[0], first_address);
+  EXPECT_EQ(s21vec1.front(), 42);
+  EXPECT_EQ(s21vec1.back(), 999);
+  EXPECT_EQ(s21vec1.at(500), 500);
+  EXPECT_THROW(s21vec1.at(1000), std::out_of_range);
+  EXPECT_EQ(s21vec1.size(), 1000U);
+  EXPECT_EQ(s21vec1.capacity(), 1008U);
+
+  auto it = s21vec1.begin() + 17;
+  for (int i = 0; i < 5000; ++i) s21vec1.push_back(-i);
+  EXPECT_EQ(*it, 17);
+  EXPECT_EQ(s21vec1.end() - s21vec1.begin(), 6000);
+  std::sort(s21vec1.begin(), s21vec1.end());
+  EXPECT_EQ(std::is_sorted(s21vec1.cbegin(), s21vec1.cend()), true);
+  EXPECT_EQ(s21vec1.front(), -4999);
+  EXPECT_EQ(*s21vec1.rbegin(), 999);
+
+  s21vec1.resize(20);
+  EXPECT_EQ(s21vec1.capacity(), 6000U);
+  s21vec1.shrink_to_fit();
+  EXPECT_EQ(s21vec1.capacity(), 32U);
+  s21vec1.resize(40, 7);
+  EXPECT_EQ(s21vec1[39], 7);
+  s21vec1.pop_back();
+  EXPECT_EQ(s21vec1.size(), 39U);
+  s21vec1.reserve(100);
+  EXPECT_EQ(s21vec1.capacity(), 112U);
+  s21vec1.clear();
+  EXPECT_EQ(s21vec1.empty(), true);
+}
+
+TEST(segmented_vector, copy_move_swap) {
+  s21::segmented_vector<std::string> s21vec1 = {"a", "bb", "ccc"};
+  s21::segmented_vector<std::string> s21vec2(s21vec1);
+  EXPECT_EQ(s21vec2.size(), 3U);
+  EXPECT_EQ(s21vec2[2], "ccc");
+  s21::segmented_vector<std::string> s21vec3(std::move(s21vec2));
+  EXPECT_EQ(s21vec2.empty(), true);
+  EXPECT_EQ(s21vec3[1], "bb");
+  s21::segmented_vector<std::string> s21vec4(70, "x");
+  s21vec4 = s21vec3;
+  EXPECT_EQ(s21vec4.size(), 3U);
+  EXPECT_EQ(s21vec4.back(), "ccc");
+  s21vec4 = std::move(s21vec1);
+  EXPECT_EQ(s21vec4[0], "a");
+  s21vec4.swap(s21vec2);
+  EXPECT_EQ(s21vec4.empty(), true);
+  EXPECT_EQ(s21vec2.size(), 3U);
+  s21::segmented_vector<std::string> s21vec5(2);
+  EXPECT_EQ(s21vec5[1], "");
+}
+
+TEST(segmented_vector, strong_push_back) {
+  s21::segmented_vector<throw_tester_class, 16> s21vec1(16);
+  throw_tester_class value;
+  value.n = 1;
+  const throw_tester_class *last = &s21vec1.back();
+  EXPECT_THROW(s21vec1.push_back(value), std::out_of_range);
+  EXPECT_EQ(s21vec1.size(), 16U);
+  EXPECT_EQ(&s21vec1.back(), last);
+}
+
+// concurrent_vector tests
+
+TEST(concurrent_vector, single_thread) {
+  s21::concurrent_vector<std::string> s21vec1;
+  EXPECT_EQ(s21vec1.empty(), true);
+  EXPECT_EQ(s21vec1.capacity(), 0U);
+  for (int i = 0; i < 100; ++i) {
+    auto it = s21vec1.push_back(std::to_string(i));
+    EXPECT_EQ(it - s21vec1.begin(), i);
+  }
+  std::string last("last");
+  s21vec1.push_back(std::move(last));
+  s21vec1.emplace_back(3, 'x');
+  EXPECT_EQ(s21vec1.size(), 102U);
+  EXPECT_GE(s21vec1.capacity(), 102U);
+  EXPECT_EQ(s21vec1.front(), "0");
+  EXPECT_EQ(s21vec1[100], "last");
+  EXPECT_EQ(s21vec1.back(), "xxx");
+  EXPECT_EQ(s21vec1.at(57), "57");
+  EXPECT_THROW(s21vec1.at(102), std::out_of_range);
+  std::size_t length = 0;
+  for (const std::string &value : s21vec1) length += value.size();
+  EXPECT_EQ(length, 10 + 90 * 2 + 4 + 3U);
+  EXPECT_EQ(s21vec1.cbegin()->size(), 1U);
+  EXPECT_EQ(s21vec1.cend() - s21vec1.cbegin(), 102);
+
+  std::size_t capacity = s21vec1.capacity();
+  s21vec1.clear();
+  EXPECT_EQ(s21vec1.empty(), true);
+  EXPECT_EQ(s21vec1.capacity(), capacity);
+  s21vec1.reserve(1000);
+  EXPECT_GE(s21vec1.capacity(), 1000U);
+  s21vec1.push_back("again");
+  EXPECT_EQ(s21vec1[0], "again");
+}
+
+TEST(concurrent_vector, parallel_push_back) {
+  constexpr int threads = 4;
+  constexpr int per_thread = 20000;
+  s21::concurrent_vector<int> s21vec1;
+  std::atomic<bool> done(false);
+  std::thread reader([&s21vec1, &done] {
+    while (!done.load()) {
+      std::size_t seen = 0;
+      for (int value : s21vec1) {
+        EXPECT_GE(value, 0);
+        EXPECT_LT(value, threads * per_thread);
+        ++seen;
+      }
+      EXPECT_LE(seen, s21vec1.size());
+    }
+  });
+  std::vector<std::thread> writers;
+  for (int t = 0; t < threads; ++t) {
+    writers.emplace_back([&s21vec1, t] {
+      for (int i = 0; i < per_thread; ++i)
+        s21vec1.push_back(t * per_thread + i);
+    });
+  }
+  for (std::thread &writer : writers) writer.join();
+  done.store(true);
+  reader.join();
+
+  EXPECT_EQ(s21vec1.size(), std::size_t(threads * per_thread));
+  std::vector<int> values(s21vec1.begin(), s21vec1.end());
+  std::sort(values.begin(), values.end());
+  for (int i = 0; i < threads * per_thread; ++i) EXPECT_EQ(values[i], i);
+}
+
+// Fails every other allocation, from whichever thread asks.
+template <class T>
+struct flaky_allocator {
+  using value_type = T;
+  static inline std::atomic<int> calls{0};
+
+  flaky_allocator() noexcept = default;
+  template <class U>
+  flaky_allocator(const flaky_allocator<U> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    if (calls.fetch_add(1) % 2 == 1) throw std::bad_alloc();
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) noexcept {
+    std::allocator<T>().deallocate(p, n);
+  }
+  template <class U>
+  bool operator==(const flaky_allocator<U> &) const noexcept {
+    return true;
+  }
+  template <class U>
+  bool operator!=(const flaky_allocator<U> &) const noexcept {
+    return false;
+  }
+};
+
+TEST(concurrent_vector, failed_allocation) {
+  constexpr int threads = 8;
+  constexpr int per_thread = 32;
+  for (int round = 0; round < 200; ++round) {
+    s21::concurrent_vector<int, flaky_allocator<int>> s21vec1;
+    std::atomic<int> pushed(0);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; ++t) {
+      writers.emplace_back([&s21vec1, &pushed, t] {
+        for (int i = 0; i < per_thread; ++i) {
+          try {
+            s21vec1.push_back(t * per_thread + i);
+            pushed.fetch_add(1);
+          } catch (const std::bad_alloc &) {
+          }
+        }
+      });
+    }
+    for (std::thread &writer : writers) writer.join();
+    ASSERT_EQ(s21vec1.size(), std::size_t(pushed.load()));
+    std::vector<int> values(s21vec1.begin(), s21vec1.end());
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(std::adjacent_find(values.begin(), values.end()), values.end());
+  }
+}
+
+// flat_set and flat_map tests
+
+TEST(flat_set, lookup_and_modifiers) {
+  s21::flat_set<int> s21set1 = {5, 1, 4, 1, 3};
+  std::set<int> stdset1 = {5, 1, 4, 1, 3};
+  EXPECT_EQ(std::equal(s21set1.begin(), s21set1.end(), stdset1.begin(),
+                       stdset1.end()), true);
+
+  for (int key = -1; key < 8; ++key) {
+    EXPECT_EQ(s21set1.contains(key), stdset1.count(key) == 1);
+    EXPECT_EQ(s21set1.lower_bound(key) - s21set1.begin(),
+              std::distance(stdset1.begin(), stdset1.lower_bound(key)));
+    EXPECT_EQ(s21set1.upper_bound(key) - s21set1.begin(),
+              std::distance(stdset1.begin(), stdset1.upper_bound(key)));
+  }
+
+  EXPECT_EQ(s21set1.insert(2).second, true);
+  EXPECT_EQ(s21set1.insert(2).second, false);
+  EXPECT_EQ(*s21set1.emplace(0).first, 0);
+  EXPECT_EQ(s21set1.erase(4), 1U);
+  EXPECT_EQ(s21set1.erase(4), 0U);
+  auto next = s21set1.erase(s21set1.find(1));
+  EXPECT_EQ(*next, 2);
+  std::vector<int> expected = {0, 2, 3, 5};
+  EXPECT_EQ(std::equal(s21set1.begin(), s21set1.end(), expected.begin(),
+                       expected.end()), true);
+  EXPECT_EQ(std::equal(s21set1.rbegin(), s21set1.rend(), expected.rbegin(),
+                       expected.rend()), true);
+}
+
+TEST(flat_set, bulk_insert) {
+  s21::flat_set<int> s21set1;
+  std::set<int> stdset1;
+  std::vector<int> batch;
+  for (int round = 0; round < 4; ++round) {
+    batch.clear();
+    for (int i = 0; i < 500; ++i) batch.push_back((i * 7919 + round) % 1000);
+    s21set1.insert(batch.begin(), batch.end());
+    stdset1.insert(batch.begin(), batch.end());
+    EXPECT_EQ(std::equal(s21set1.begin(), s21set1.end(), stdset1.begin(),
+                         stdset1.end()), true);
+  }
+
+  std::list<std::string> words = {"pear", "apple", "fig", "apple"};
+  s21::flat_set<std::string, std::greater<std::string>> s21set2(
+      words.begin(), words.end());
+  std::vector<std::string> expected = {"pear", "fig", "apple"};
+  EXPECT_EQ(std::equal(s21set2.begin(), s21set2.end(), expected.begin(),
+                       expected.end()), true);
+
+  auto by_first = [](const std::pair<int, int> &lhs,
+                     const std::pair<int, int> &rhs) {
+    return lhs.first < rhs.first;
+  };
+  s21::flat_set<std::pair<int, int>, decltype(by_first)> s21set3(by_first);
+  std::vector<std::pair<int, int>> pairs;
+  for (int i = 0; i < 200; ++i) pairs.push_back({(i * 37) % 10, i});
+  s21set3.insert(pairs.begin(), pairs.end());
+  ASSERT_EQ(s21set3.size(), 10U);
+  for (int i = 0; i < 10; ++i) {
+    auto it = s21set3.find({i, 0});
+    ASSERT_EQ(it != s21set3.end(), true);
+    EXPECT_EQ(it->second, (i * 3) % 10);
+  }
+}
+
+struct throwing_less {
+  static inline int calls_left = -1;
+  bool operator()(const std::string &lhs, const std::string &rhs) const {
+    if (calls_left == 0) throw std::runtime_error("compare failed");
+    if (calls_left > 0) --calls_left;
+    return lhs < rhs;
+  }
+};
+
+TEST(flat_set, throwing_compare_on_bulk_insert) {
+  std::string long_key(40, 'k');
+  std::vector<std::string> old_keys = {long_key + "1", long_key + "3",
+                                       long_key + "5"};
+  std::vector<std::string> batch = {long_key + "4", long_key + "2"};
+  int failures = 0;
+  for (int calls = 0; failures == calls; ++calls) {
+    s21::flat_set<std::string, throwing_less> s21set1(old_keys.begin(),
+                                                      old_keys.end());
+    throwing_less::calls_left = calls;
+    try {
+      s21set1.insert(batch.begin(), batch.end());
+    } catch (const std::runtime_error &) {
+      ++failures;
+    }
+    throwing_less::calls_left = -1;
+    if (failures > calls) {
+      EXPECT_EQ(std::equal(s21set1.begin(), s21set1.end(), old_keys.begin(),
+                           old_keys.end()),
+                true);
+    } else {
+      EXPECT_EQ(s21set1.size(), 5U);
+    }
+  }
+  EXPECT_GT(failures, 2);
+}
+
+TEST(flat_map, lookup_and_modifiers) {
+  s21::flat_map<int, std::string> s21map1 = {
+      {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+  EXPECT_EQ(s21map1.size(), 3U);
+  EXPECT_EQ(s21map1.at(1), "one");
+  EXPECT_THROW(s21map1.at(4), std::out_of_range);
+  EXPECT_EQ(s21map1.count(2), 1U);
+  EXPECT_EQ(s21map1.contains(0), false);
+
+  s21map1[4] = "four";
+  s21map1[1] += "!";
+  EXPECT_EQ(s21map1.insert({2, "dos"}).second, false);
+  EXPECT_EQ(s21map1.insert_or_assign(2, "dos").second, false);
+  EXPECT_EQ(s21map1.try_emplace(0, 4, 'z').second, true);
+  EXPECT_EQ(s21map1.emplace(5, "five").second, true);
+  EXPECT_EQ((*s21map1.find(2)).second, "dos");
+  EXPECT_EQ(s21map1.find(7), s21map1.end());
+  EXPECT_EQ((*s21map1.lower_bound(3)).first, 3);
+  EXPECT_EQ((*s21map1.upper_bound(3)).first, 4);
+  EXPECT_EQ(s21map1.erase(3), 1U);
+  auto next = s21map1.erase(s21map1.find(4));
+  EXPECT_EQ((*next).first, 5);
+
+  std::vector<int> keys = {0, 1, 2, 5};
+  std::vector<std::string> values = {"zzzz", "one!", "dos", "five"};
+  EXPECT_EQ(std::equal(s21map1.keys().begin(), s21map1.keys().end(),
+                       keys.begin(), keys.end()), true);
+  EXPECT_EQ(std::equal(s21map1.values().begin(), s21map1.values().end(),
+                       values.begin(), values.end()), true);
+  std::size_t i = 0;
+  for (auto entry : s21map1) {
+    EXPECT_EQ(entry.first, keys[i]);
+    EXPECT_EQ(entry.second, values[i]);
+    ++i;
+  }
+  EXPECT_EQ(i, s21map1.size());
+}
+
+TEST(flat_map, bulk_insert) {
+  s21::flat_map<int, int> s21map1;
+  std::map<int, int> stdmap1;
+  std::vector<std::pair<int, int>> batch;
+  for (int round = 0; round < 4; ++round) {
+    batch.clear();
+    for (int i = 0; i < 500; ++i)
+      batch.emplace_back((i * 7919 + round) % 1000, round * 1000 + i);
+    s21map1.insert(batch.begin(), batch.end());
+    stdmap1.insert(batch.begin(), batch.end());
+    ASSERT_EQ(s21map1.size(), stdmap1.size());
+    EXPECT_EQ(std::equal(s21map1.begin(), s21map1.end(), stdmap1.begin(),
+                         [](auto lhs, const std::pair<const int, int> &rhs) {
+                           return lhs.first == rhs.first &&
+                                  lhs.second == rhs.second;
+                         }), true);
+  }
+
+  s21::flat_map<std::string, int> s21map2;
+  s21map2.insert({{"b", 1}, {"a", 2}, {"b", 3}});
+  s21::flat_map<std::string, int> s21map3;
+  s21map3.swap(s21map2);
+  EXPECT_EQ(s21map2.empty(), true);
+  EXPECT_EQ(s21map3.at("a"), 2);
+  EXPECT_EQ(s21map3.at("b"), 1);
+}
+
+TEST(flat_map, strong_bulk_insert) {
+  std::string long_key(40, 'k');
+  s21::flat_map<std::string, throw_tester_class> s21map1;
+  s21map1.try_emplace(long_key + "1");
+  s21map1.try_emplace(long_key + "2");
+  s21map1.at(long_key + "2").n = 1;
+  std::vector<std::pair<std::string, throw_tester_class>> batch(1);
+  batch[0].first = long_key + "0";
+  EXPECT_THROW(s21map1.insert(batch.begin(), batch.end()), std::out_of_range);
+  EXPECT_EQ(s21map1.size(), 2U);
+  EXPECT_EQ(s21map1.keys()[0], long_key + "1");
+  EXPECT_EQ(s21map1.keys()[1], long_key + "2");
+  EXPECT_EQ(s21map1.values()[0].m != nullptr, true);
+  s21map1.at(long_key + "2").n = 10;
+}
+
+TEST(flat_map, throwing_compare_on_bulk_insert) {
+  std::string long_key(40, 'k');
+  std::vector<std::pair<std::string, std::string>> old_entries = {
+      {long_key + "1", long_key}, {long_key + "3", long_key}};
+  std::vector<std::pair<std::string, std::string>> batch = {
+      {long_key + "2", long_key}, {long_key + "0", long_key}};
+  int failures = 0;
+  for (int calls = 0; failures == calls; ++calls) {
+    s21::flat_map<std::string, std::string, throwing_less> s21map1(
+        old_entries.begin(), old_entries.end());
+    throwing_less::calls_left = calls;
+    try {
+      s21map1.insert(batch.begin(), batch.end());
+    } catch (const std::runtime_error &) {
+      ++failures;
+    }
+    throwing_less::calls_left = -1;
+    if (failures > calls) {
+      ASSERT_EQ(s21map1.size(), 2U);
+      EXPECT_EQ(s21map1.keys()[0], long_key + "1");
+      EXPECT_EQ(s21map1.keys()[1], long_key + "3");
+      EXPECT_EQ(s21map1.values()[1], long_key);
+    } else {
+      EXPECT_EQ(s21map1.size(), 4U);
+    }
+  }
+  EXPECT_GT(failures, 2);
+}
+
+// flat_hash_map tests
+
+// Sends every key to one of eight home slots, so probe runs are long and
+// wrap around the end of the table.
+struct clustered_hash {
+  std::size_t operator()(int key) const { return std::size_t(key) % 8; }
+};
+
+struct throwing_hash {
+  static inline int calls_left = -1;
+  std::size_t operator()(int key) const {
+    if (calls_left == 0) throw std::runtime_error("hash failed");
+    if (calls_left > 0) --calls_left;
+    return std::hash<int>()(key);
+  }
+};
+
+template <class Hash>
+void check_hash_map_churn() {
+  s21::flat_hash_map<int, int, Hash> s21map1;
+  std::unordered_map<int, int> stdmap1;
+  std::uint32_t state = 12345;
+  for (int step = 0; step < 20000; ++step) {
+    state = state * 1664525U + 1013904223U;
+    int key = static_cast<int>(state >> 8) % 300;
+    if (state % 3 == 0) {
+      EXPECT_EQ(s21map1.erase(key), stdmap1.erase(key));
+    } else {
+      EXPECT_EQ(s21map1.insert({key, step}).second,
+                stdmap1.insert({key, step}).second);
+    }
+    if (step % 1000 == 0) {
+      ASSERT_EQ(s21map1.size(), stdmap1.size());
+      for (int probe = 0; probe < 300; ++probe) {
+        auto found = s21map1.find(probe);
+        auto expected = stdmap1.find(probe);
+        ASSERT_EQ(found == s21map1.end(), expected == stdmap1.end());
+        if (expected != stdmap1.end()) {
+          EXPECT_EQ(found->second, expected->second);
+        }
+      }
+      EXPECT_LE(s21map1.load_factor(), s21map1.max_load_factor());
+    }
+  }
+  std::size_t visited = 0;
+  for (const auto &entry : s21map1) {
+    EXPECT_EQ(stdmap1.at(entry.first), entry.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, stdmap1.size());
+}
+
+TEST(flat_hash_map, matches_unordered_map) {
+  check_hash_map_churn<std::hash<int>>();
+  check_hash_map_churn<clustered_hash>();
+}
+
+TEST(flat_hash_map, lookup_and_modifiers) {
+  s21::flat_hash_map<std::string, int> s21map1 = {
+      {"one", 1}, {"two", 2}, {"one", 11}};
+  EXPECT_EQ(s21map1.size(), 2U);
+  EXPECT_EQ(s21map1.at("one"), 1);
+  EXPECT_THROW(s21map1.at("three"), std::out_of_range);
+  s21map1["three"] = 3;
+  s21map1["one"] += 10;
+  EXPECT_EQ(s21map1.insert_or_assign("two", 22).second, false);
+  EXPECT_EQ(s21map1.try_emplace("four", 4).second, true);
+  EXPECT_EQ(s21map1.try_emplace("four", 44).second, false);
+  EXPECT_EQ(s21map1.emplace("five", 5).second, true);
+  EXPECT_EQ(s21map1.count("four"), 1U);
+  s21map1.erase(s21map1.find("four"));
+  EXPECT_EQ(s21map1.contains("four"), false);
+  std::map<std::string, int> expected = {
+      {"five", 5}, {"one", 11}, {"three", 3}, {"two", 22}};
+  std::map<std::string, int> contents(s21map1.begin(), s21map1.end());
+  EXPECT_EQ(contents, expected);
+
+  s21::flat_hash_map<std::string, int> s21map2(s21map1);
+  s21::flat_hash_map<std::string, int> s21map3(std::move(s21map1));
+  EXPECT_EQ(s21map1.empty(), true);
+  EXPECT_EQ(s21map1.find("one"), s21map1.end());
+  s21map1 = s21map2;
+  s21map2.clear();
+  s21map2.swap(s21map3);
+  EXPECT_EQ(s21map3.empty(), true);
+  contents.clear();
+  contents.insert(s21map1.begin(), s21map1.end());
+  EXPECT_EQ(contents, expected);
+  contents.clear();
+  contents.insert(s21map2.begin(), s21map2.end());
+  EXPECT_EQ(contents, expected);
+
+  s21map2.max_load_factor(0.5f);
+  s21map2.reserve(100);
+  EXPECT_EQ(s21map2.capacity(), 256U);
+  s21map2.rehash(0);
+  EXPECT_EQ(s21map2.capacity(), 16U);
+  EXPECT_EQ(s21map2.at("five"), 5);
+}
+
+TEST(flat_hash_map, throwing_hash_on_rehash) {
+  s21::flat_hash_map<int, std::string, throwing_hash> s21map1;
+  s21map1.max_load_factor(0.5f);
+  for (int i = 0; i < 8; ++i) s21map1.try_emplace(i, 20, 'x');
+  ASSERT_EQ(s21map1.capacity(), 16U);
+  throwing_hash::calls_left = 3;
+  EXPECT_THROW(s21map1.try_emplace(8, 20, 'x'), std::runtime_error);
+  throwing_hash::calls_left = -1;
+  EXPECT_EQ(s21map1.size(), 8U);
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(s21map1.at(i), std::string(20, 'x'));
+  s21map1.try_emplace(8, 20, 'x');
+  EXPECT_EQ(s21map1.size(), 9U);
+}
+
+TEST(flat_hash_map, throwing_hash_on_erase) {
+  s21::flat_hash_map<int, std::string, throwing_hash> s21map1;
+  std::set<int> keys;
+  for (int i = 0; i < 14; ++i) {
+    s21map1.try_emplace(i, 20, 'x');
+    keys.insert(i);
+  }
+  int failures = 0;
+  for (int i = 0; i < 14; ++i) {
+    throwing_hash::calls_left = 1;
+    try {
+      s21map1.erase(i);
+      keys.erase(i);
+    } catch (const std::runtime_error &) {
+      ++failures;
+    }
+    throwing_hash::calls_left = -1;
+    ASSERT_EQ(s21map1.size(), keys.size());
+    for (int key : keys) EXPECT_EQ(s21map1.at(key), std::string(20, 'x'));
+  }
+  EXPECT_GT(failures, 0);
+}
+
+TEST(flat_hash_map, arena_allocator) {
+  using value_type = std::pair<const int, std::string>;
+  s21::arena arena;
+  s21::arena_allocator<value_type> alloc(arena);
+  s21::flat_hash_map<int, std::string, std::hash<int>, std::equal_to<int>,
+                     s21::arena_allocator<value_type>>
+      s21map1(alloc);
+  for (int i = 0; i < 100; ++i) s21map1.try_emplace(i, 20, 'x');
+  EXPECT_GT(arena.bytes_reserved(), 0U);
+  EXPECT_EQ(s21map1.get_allocator().resource(), &arena);
+  for (int i = 0; i < 100; i += 2) s21map1.erase(i);
+  EXPECT_EQ(s21map1.size(), 50U);
+  EXPECT_EQ(s21map1.at(51), std::string(20, 'x'));
+}
+
+// static_vector tests
+
+template <class T, std::size_t N>
+bool same_elements(const std::vector<T> &std_vec,
+                   const s21::static_vector<T, N> &s21_vec) {
+  return std_vec.size() == s21_vec.size() &&
+         std::equal(std_vec.begin(), std_vec.end(), s21_vec.begin());
+}
+
+TEST(static_vector, modifiers) {
+  std::vector<std::string> stdvec1 = {"a", "b", "c"};
+  s21::static_vector<std::string, 16> s21vec1 = {"a", "b", "c"};
+  EXPECT_EQ(same_elements(stdvec1, s21vec1), true);
+  EXPECT_EQ(s21vec1.capacity(), 16U);
+
+  stdvec1.push_back("d");
+  s21vec1.push_back("d");
+  stdvec1.insert(stdvec1.begin() + 1, "e");
+  s21vec1.insert(s21vec1.begin() + 1, "e");
+  stdvec1.emplace(stdvec1.begin(), 3, 'f');
+  s21vec1.emplace(s21vec1.begin(), 3, 'f');
+  stdvec1.insert(stdvec1.begin() + 2, 2, stdvec1.back());
+  s21vec1.insert(s21vec1.begin() + 2, 2, s21vec1.back());
+  stdvec1.insert(stdvec1.end() - 1, {"g", "h"});
+  s21vec1.insert(s21vec1.end() - 1, {"g", "h"});
+  EXPECT_EQ(same_elements(stdvec1, s21vec1), true);
+
+  stdvec1.erase(stdvec1.begin() + 1, stdvec1.begin() + 4);
+  s21vec1.erase(s21vec1.begin() + 1, s21vec1.begin() + 4);
+  stdvec1.erase(stdvec1.begin());
+  s21vec1.erase(s21vec1.begin());
+  stdvec1.pop_back();
+  s21vec1.pop_back();
+  EXPECT_EQ(same_elements(stdvec1, s21vec1), true);
+
+  stdvec1.resize(10, "i");
+  s21vec1.resize(10, "i");
+  stdvec1.resize(12);
+  s21vec1.resize(12);
+  EXPECT_EQ(same_elements(stdvec1, s21vec1), true);
+  stdvec1.resize(2);
+  s21vec1.resize(2);
+  EXPECT_EQ(same_elements(stdvec1, s21vec1), true);
+
+  stdvec1.assign(5, "j");
+  s21vec1.assign(5, "j");
+  EXPECT_EQ(same_elements(stdvec1, s21vec1), true);
+  stdvec1.assign({"k", "l"});
+  s21vec1.assign({"k", "l"});
+  EXPECT_EQ(same_elements(stdvec1, s21vec1), true);
+  EXPECT_EQ(s21vec1.at(1), "l");
+  EXPECT_THROW(s21vec1.at(2), std::out_of_range);
+  s21vec1.clear();
+  EXPECT_EQ(s21vec1.empty(), true);
+}
+
+TEST(static_vector, copy_move_swap) {
+  s21::static_vector<std::string, 8> s21vec1(3, "three");
+  s21::static_vector<std::string, 8> s21vec2(6, "six");
+
+  s21::static_vector<std::string, 8> s21vec3(s21vec1);
+  EXPECT_EQ(s21vec3.size(), 3U);
+  EXPECT_EQ(s21vec3[2], "three");
+  s21::static_vector<std::string, 8> s21vec4(std::move(s21vec3));
+  EXPECT_EQ(s21vec4.size(), 3U);
+
+  s21vec4 = s21vec2;
+  EXPECT_EQ(s21vec4.size(), 6U);
+  EXPECT_EQ(s21vec4[5], "six");
+  s21vec4 = s21vec1;
+  EXPECT_EQ(s21vec4.size(), 3U);
+  s21vec3 = std::move(s21vec2);
+  EXPECT_EQ(s21vec3.size(), 6U);
+
+  s21vec1.swap(s21vec3);
+  EXPECT_EQ(s21vec1.size(), 6U);
+  EXPECT_EQ(s21vec3.size(), 3U);
+  EXPECT_EQ(s21vec1.back(), "six");
+  EXPECT_EQ(s21vec3.back(), "three");
+  s21vec3.swap(s21vec1);
+  EXPECT_EQ(s21vec1.back(), "three");
+  EXPECT_EQ(s21vec3[5], "six");
+}
+
+TEST(static_vector, overflow) {
+  s21::static_vector<int, 4> s21vec1(4, 1);
+  EXPECT_THROW(s21vec1.push_back(2), std::length_error);
+  EXPECT_THROW(s21vec1.insert(s21vec1.begin(), 2), std::length_error);
+  EXPECT_THROW(s21vec1.resize(5), std::length_error);
+  EXPECT_THROW(s21vec1.reserve(5), std::length_error);
+  EXPECT_THROW((s21::static_vector<int, 2>({1, 2, 3})), std::length_error);
+  EXPECT_EQ(s21vec1.size(), 4U);
+
+  s21::static_vector<int, 4, s21::abort_on_overflow> s21vec2(4, 1);
+  s21vec2.pop_back();
+  s21vec2.push_back(2);
+  EXPECT_EQ(s21vec2.back(), 2);
+  EXPECT_DEATH(s21vec2.push_back(3), "capacity exceeded");
+}
+
+TEST(static_vector, trivially_copyable) {
+  EXPECT_EQ((std::is_trivially_copyable_v<s21::static_vector<int, 8>>), true);
+  EXPECT_EQ(
+      (std::is_trivially_copyable_v<s21::static_vector<std::string, 8>>),
+      false);
+
+  s21::static_vector<int, 8> s21vec1 = {1, 2, 3};
+  s21::static_vector<int, 8> s21vec2;
+  std::memcpy(static_cast<void *>(&s21vec2), &s21vec1, sizeof(s21vec1));
+  EXPECT_EQ(s21vec2.size(), 3U);
+  EXPECT_EQ(s21vec2[2], 3);
+
+  s21::static_vector<int, 8> s21vec3(5, s21::default_init);
+  EXPECT_EQ(s21vec3.size(), 5U);
+  s21vec3.resize_for_overwrite(8);
+  EXPECT_EQ(s21vec3.size(), 8U);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,1036 @@
+#ifndef S21_FLAT_HASH_MAP_H_
+#define S21_FLAT_HASH_MAP_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Sixteen control bytes of a flat_hash_map examined at once. A full slot
+// holds seven bits of its hash, an empty one has only the sign bit set.
+class hash_group {
+ public:
+  static constexpr std::size_t width = 16;
+  static constexpr std::int8_t empty = -128;
+
+  explicit hash_group(const std::int8_t *ctrl) noexcept;
+
+  std::uint32_t match(std::int8_t h2) const noexcept;
+  std::uint32_t match_empty() const noexcept;
+  std::uint32_t match_full() const noexcept;
+
+ private:
+#if defined(__SSE2__)
+  __m128i _ctrl;
+#else
+  const std::int8_t *_ctrl;
+#endif
+};
+
+#if defined(__SSE2__)
+inline hash_group::hash_group(const std::int8_t *ctrl) noexcept
+    : _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+
+inline std::uint32_t hash_group::match(std::int8_t h2) const noexcept {
+  return static_cast<std::uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl)));
+}
+
+inline std::uint32_t hash_group::match_empty() const noexcept {
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(_ctrl));
+}
+#else
+inline hash_group::hash_group(const std::int8_t *ctrl) noexcept
+    : _ctrl(ctrl) {}
+
+inline std::uint32_t hash_group::match(std::int8_t h2) const noexcept {
+  std::uint32_t mask = 0;
+  for (std::size_t i = 0; i < width; ++i)
+    mask |= static_cast<std::uint32_t>(_ctrl[i] == h2) << i;
+  return mask;
+}
+
+inline std::uint32_t hash_group::match_empty() const noexcept {
+  std::uint32_t mask = 0;
+  for (std::size_t i = 0; i < width; ++i)
+    mask |= static_cast<std::uint32_t>(_ctrl[i] < 0) << i;
+  return mask;
+}
+#endif
+
+inline std::uint32_t hash_group::match_full() const noexcept {
+  return ~match_empty() & 0xffffu;
+}
+
+// Storage of one flat_hash_map element. Elements are created as value;
+// mutable_value names the same pair with a non-const key, so the map can
+// move keys when it rehashes or shifts elements on erase. The map creates
+// and destroys the members itself, guided by the control bytes, so copying
+// a slot only copies its bytes and the slot is relocatable as raw bytes.
+template <class Key, class T>
+union flat_hash_map_slot {
+  flat_hash_map_slot() noexcept {}
+  flat_hash_map_slot(const flat_hash_map_slot &other) noexcept {
+    std::memcpy(static_cast<void *>(this), &other, sizeof(*this));
+  }
+  flat_hash_map_slot &operator=(const flat_hash_map_slot &other) noexcept {
+    std::memmove(static_cast<void *>(this), &other, sizeof(*this));
+    return *this;
+  }
+  ~flat_hash_map_slot() {}
+
+  std::pair<const Key, T> value;
+  std::pair<Key, T> mutable_value;
+};
+
+template <class Key, class T>
+struct is_trivially_relocatable<flat_hash_map_slot<Key, T>> : std::true_type {
+};
+
+// Open-addressing hash map with linear probing. Elements live in a slot
+// array and a parallel control array holds one byte per slot, so a probe
+// compares sixteen candidates with one group match before it touches any
+// key. Erase shifts the rest of the probe run back instead of leaving a
+// tombstone, so lookups never slow down after churn. Both arrays are
+// s21::vectors using the map's allocator rebound to their element types.
+// Inserts that grow the table and every erase invalidate iterators.
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class flat_hash_map {
+  static_assert(std::is_nothrow_move_constructible_v<Key> &&
+                    std::is_nothrow_move_constructible_v<T>,
+                "flat_hash_map moves elements when it rehashes and erases");
+  static_assert(std::is_standard_layout_v<std::pair<const Key, T>> &&
+                    std::is_standard_layout_v<std::pair<Key, T>>,
+                "flat_hash_map moves keys through a layout-compatible pair");
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+ private:
+  using allocator_traits = std::allocator_traits<Allocator>;
+
+  using slot = flat_hash_map_slot<Key, T>;
+  using slot_allocator =
+      typename allocator_traits::template rebind_alloc<slot>;
+  using ctrl_allocator =
+      typename allocator_traits::template rebind_alloc<std::int8_t>;
+  using hash_allocator =
+      typename allocator_traits::template rebind_alloc<std::uint64_t>;
+
+  template <bool IsConst>
+  class common_iterator {
+   public:
+    using value_type = flat_hash_map::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const value_type *,
+                                       value_type *>;
+    using reference = std::conditional_t<IsConst, const value_type &,
+                                         value_type &>;
+    using iterator_category = std::forward_iterator_tag;
+    using container_type =
+        std::conditional_t<IsConst, const flat_hash_map, flat_hash_map>;
+
+    template <bool IsConstFriend>
+    friend class common_iterator;
+    friend class flat_hash_map;
+
+    common_iterator(container_type *map, size_t pos) noexcept;
+    common_iterator() noexcept;
+
+    operator common_iterator<true>() const noexcept;
+
+    reference operator*() const;
+    pointer operator->() const;
+
+    common_iterator<IsConst> &operator++();
+    common_iterator<IsConst> operator++(int);
+
+    inline bool operator==(const common_iterator<true> &other) const noexcept;
+    inline bool operator!=(const common_iterator<true> &other) const noexcept;
+
+   private:
+    container_type *_map;
+    size_t _pos;
+  };
+
+ public:
+  using iterator = common_iterator<false>;
+  using const_iterator = common_iterator<true>;
+
+  static constexpr float default_max_load_factor = 0.875f;
+
+  flat_hash_map();
+  explicit flat_hash_map(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual(),
+                         const Allocator &alloc = Allocator());
+  explicit flat_hash_map(const Allocator &alloc);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  flat_hash_map(InputIt first, InputIt last, size_type bucket_count = 0,
+                const Hash &hash = Hash(), const KeyEqual &equal = KeyEqual(),
+                const Allocator &alloc = Allocator());
+  flat_hash_map(std::initializer_list<value_type> init,
+                size_type bucket_count = 0, const Hash &hash = Hash(),
+                const KeyEqual &equal = KeyEqual(),
+                const Allocator &alloc = Allocator());
+  flat_hash_map(const flat_hash_map &other);
+  flat_hash_map(flat_hash_map &&other) noexcept;
+  ~flat_hash_map();
+  flat_hash_map &operator=(const flat_hash_map &other);
+  flat_hash_map &operator=(flat_hash_map &&other) noexcept(
+      allocator_traits::propagate_on_container_move_assignment::value ||
+      allocator_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type capacity() const noexcept;
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  void insert(InputIt first, InputIt last);
+  void insert(std::initializer_list<value_type> ilist);
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, M &&obj);
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(Key &&key, M &&obj);
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+  void erase(const_iterator pos);
+  size_type erase(const Key &key);
+  void swap(flat_hash_map &other) noexcept(
+      allocator_traits::propagate_on_container_swap::value ||
+      allocator_traits::is_always_equal::value);
+
+  T &at(const Key &key);
+  const T &at(const Key &key) const;
+  T &operator[](const Key &key);
+  T &operator[](Key &&key);
+  size_type count(const Key &key) const;
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+
+  float load_factor() const noexcept;
+  float max_load_factor() const noexcept;
+  void max_load_factor(float ml);
+  void rehash(size_type count);
+  void reserve(size_type count);
+
+  hasher hash_function() const;
+  key_equal key_eq() const;
+
+ private:
+  static std::int8_t h2(std::uint64_t hash) noexcept;
+  std::uint64_t hash_of(const Key &key) const;
+  size_type home(std::uint64_t hash) const noexcept;
+  value_type *element(size_type pos) noexcept;
+  const value_type *element(size_type pos) const noexcept;
+  size_type find_index(const Key &key) const;
+  size_type find_empty(std::uint64_t hash) const noexcept;
+  size_type next_full(size_type pos) const noexcept;
+  size_type growth_limit(size_type capacity) const noexcept;
+  size_type capacity_for(size_type count) const noexcept;
+  void set_ctrl(size_type pos, std::int8_t value) noexcept;
+  template <class K, class... Args>
+  std::pair<iterator, bool> emplace_key(K &&key, Args &&...args);
+  void relocate(slot &from, slot &to) noexcept;
+  void erase_at(size_type pos);
+  void resize_table(size_type new_capacity);
+  void destroy_elements() noexcept;
+  void steal(flat_hash_map &other) noexcept;
+
+  vector<std::int8_t, ctrl_allocator> _ctrl;
+  vector<slot, slot_allocator> _slots;
+  size_type _size;
+  size_type _growth_limit;
+  float _max_load;
+  Hash _hash;
+  KeyEqual _equal;
+  Allocator _allocator;
+};
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::flat_hash_map()
+    : flat_hash_map(0) {}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::flat_hash_map(
+    size_type bucket_count, const Hash &hash, const KeyEqual &equal,
+    const Allocator &alloc)
+    : _ctrl(ctrl_allocator(alloc)),
+      _slots(slot_allocator(alloc)),
+      _size(0),
+      _growth_limit(0),
+      _max_load(default_max_load_factor),
+      _hash(hash),
+      _equal(equal),
+      _allocator(alloc) {
+  if (bucket_count > 0) rehash(bucket_count);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::flat_hash_map(
+    const Allocator &alloc)
+    : flat_hash_map(0, Hash(), KeyEqual(), alloc) {}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::flat_hash_map(
+    InputIt first, InputIt last, size_type bucket_count, const Hash &hash,
+    const KeyEqual &equal, const Allocator &alloc)
+    : flat_hash_map(bucket_count, hash, equal, alloc) {
+  insert(first, last);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::flat_hash_map(
+    std::initializer_list<value_type> init, size_type bucket_count,
+    const Hash &hash, const KeyEqual &equal, const Allocator &alloc)
+    : flat_hash_map(bucket_count, hash, equal, alloc) {
+  insert(init.begin(), init.end());
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::flat_hash_map(
+    const flat_hash_map &other)
+    : flat_hash_map(0, other._hash, other._equal,
+                    allocator_traits::select_on_container_copy_construction(
+                        other._allocator)) {
+  _max_load = other._max_load;
+  reserve(other._size);
+  for (const value_type &value : other) emplace_key(value.first, value.second);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::flat_hash_map(
+    flat_hash_map &&other) noexcept
+    : _ctrl(std::move(other._ctrl)),
+      _slots(std::move(other._slots)),
+      _size(other._size),
+      _growth_limit(other._growth_limit),
+      _max_load(other._max_load),
+      _hash(std::move(other._hash)),
+      _equal(std::move(other._equal)),
+      _allocator(std::move(other._allocator)) {
+  other._size = 0;
+  other._growth_limit = 0;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::~flat_hash_map() {
+  destroy_elements();
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator> &
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::operator=(
+    const flat_hash_map &other) {
+  if (this == &other) return *this;
+  constexpr bool propagate =
+      allocator_traits::propagate_on_container_copy_assignment::value;
+  flat_hash_map copy(0, other._hash, other._equal,
+                     propagate ? other._allocator : _allocator);
+  copy._max_load = other._max_load;
+  copy.reserve(other._size);
+  for (const value_type &value : other)
+    copy.emplace_key(value.first, value.second);
+  destroy_elements();
+  if constexpr (propagate) _allocator = other._allocator;
+  _ctrl = std::move(copy._ctrl);
+  _slots = std::move(copy._slots);
+  _size = copy._size;
+  _growth_limit = copy._growth_limit;
+  _max_load = copy._max_load;
+  _hash = copy._hash;
+  _equal = copy._equal;
+  copy._size = 0;
+  copy._growth_limit = 0;
+  return *this;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator> &
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::operator=(
+    flat_hash_map &&other) noexcept(
+    allocator_traits::propagate_on_container_move_assignment::value ||
+    allocator_traits::is_always_equal::value) {
+  if (this == &other) return *this;
+  if (allocator_traits::propagate_on_container_move_assignment::value ||
+      allocator_traits::is_always_equal::value ||
+      _allocator == other._allocator) {
+    steal(other);
+  } else {
+    clear();
+    _max_load = other._max_load;
+    _hash = other._hash;
+    _equal = other._equal;
+    reserve(other._size);
+    for (value_type &value : other)
+      emplace_key(value.first, std::move(value.second));
+    other.clear();
+  }
+  return *this;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::allocator_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::get_allocator()
+    const noexcept {
+  return _allocator;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::begin() noexcept {
+  return iterator(this, next_full(0));
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::begin() const noexcept {
+  return const_iterator(this, next_full(0));
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::cbegin() const noexcept {
+  return begin();
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::end() noexcept {
+  return iterator(this, capacity());
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::end() const noexcept {
+  return const_iterator(this, capacity());
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::cend() const noexcept {
+  return end();
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+bool flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::empty()
+    const noexcept {
+  return _size == 0;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size() const noexcept {
+  return _size;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::max_size() const noexcept {
+  return _slots.max_size() / 8 * 7;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::capacity() const noexcept {
+  return _slots.size();
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::clear() noexcept {
+  destroy_elements();
+  std::fill(_ctrl.begin(), _ctrl.end(), hash_group::empty);
+  _size = 0;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+std::pair<typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::insert(
+    const value_type &value) {
+  return emplace_key(value.first, value.second);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+std::pair<typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::insert(value_type &&value) {
+  return emplace_key(value.first, std::move(value.second));
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::insert(InputIt first,
+                                                              InputIt last) {
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                  typename std::iterator_traits<
+                                      InputIt>::iterator_category>)
+    reserve(_size + std::distance(first, last));
+  for (; first != last; ++first) {
+    auto &&value = *first;
+    emplace_key(value.first, value.second);
+  }
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::insert(
+    std::initializer_list<value_type> ilist) {
+  insert(ilist.begin(), ilist.end());
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <class M>
+std::pair<typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::insert_or_assign(
+    const Key &key, M &&obj) {
+  std::pair<iterator, bool> result = emplace_key(key, std::forward<M>(obj));
+  if (!result.second) result.first->second = std::forward<M>(obj);
+  return result;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <class M>
+std::pair<typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::insert_or_assign(Key &&key,
+                                                                   M &&obj) {
+  std::pair<iterator, bool> result =
+      emplace_key(std::move(key), std::forward<M>(obj));
+  if (!result.second) result.first->second = std::forward<M>(obj);
+  return result;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <class... Args>
+std::pair<typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::emplace(Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return emplace_key(value.first, std::move(value.second));
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <class... Args>
+std::pair<typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::try_emplace(
+    const Key &key, Args &&...args) {
+  return emplace_key(key, std::forward<Args>(args)...);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <class... Args>
+std::pair<typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::try_emplace(
+    Key &&key, Args &&...args) {
+  return emplace_key(std::move(key), std::forward<Args>(args)...);
+}
+
+// Returns nothing: the element that takes the erased slot may come from
+// the front of the table, so "the next element" is not well defined.
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::erase(
+    const_iterator pos) {
+  erase_at(pos._pos);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::erase(const Key &key) {
+  size_type pos = find_index(key);
+  if (pos == capacity()) return 0;
+  erase_at(pos);
+  return 1;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::swap(
+    flat_hash_map &other) noexcept(allocator_traits::
+                                       propagate_on_container_swap::value ||
+                                   allocator_traits::is_always_equal::value) {
+  _ctrl.swap(other._ctrl);
+  _slots.swap(other._slots);
+  std::swap(_size, other._size);
+  std::swap(_growth_limit, other._growth_limit);
+  std::swap(_max_load, other._max_load);
+  std::swap(_hash, other._hash);
+  std::swap(_equal, other._equal);
+  if constexpr (allocator_traits::propagate_on_container_swap::value)
+    std::swap(_allocator, other._allocator);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+T &flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::at(const Key &key) {
+  size_type pos = find_index(key);
+  if (pos == capacity()) throw std::out_of_range("Key not found");
+  return element(pos)->second;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+const T &flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::at(
+    const Key &key) const {
+  size_type pos = find_index(key);
+  if (pos == capacity()) throw std::out_of_range("Key not found");
+  return element(pos)->second;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+T &flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::operator[](
+    const Key &key) {
+  return emplace_key(key).first->second;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+T &flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::operator[](Key &&key) {
+  return emplace_key(std::move(key)).first->second;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::count(
+    const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::find(const Key &key) {
+  return iterator(this, find_index(key));
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::const_iterator
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::find(
+    const Key &key) const {
+  return const_iterator(this, find_index(key));
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+bool flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::contains(
+    const Key &key) const {
+  return find_index(key) != capacity();
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+float flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::load_factor()
+    const noexcept {
+  return capacity() == 0 ? 0.0f
+                         : static_cast<float>(_size) /
+                               static_cast<float>(capacity());
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+float flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::max_load_factor()
+    const noexcept {
+  return _max_load;
+}
+
+// Linear probing needs free slots to end its runs, so the factor is clamped
+// to [1/16, 7/8].
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::max_load_factor(
+    float ml) {
+  _max_load = std::clamp(ml, 0.0625f, default_max_load_factor);
+  _growth_limit = growth_limit(capacity());
+  if (_size > _growth_limit) resize_table(capacity_for(_size));
+}
+
+// The capacity becomes the smallest power of two that is at least count
+// and still keeps the current elements under the maximum load factor;
+// rehash(0) on an empty map releases the table.
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::rehash(
+    size_type count) {
+  size_type new_capacity = 0;
+  if (count > 0 || _size > 0) {
+    new_capacity = capacity_for(_size);
+    while (new_capacity < count) new_capacity *= 2;
+  }
+  if (new_capacity != capacity()) resize_table(new_capacity);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::reserve(
+    size_type count) {
+  if (count > _growth_limit) resize_table(capacity_for(count));
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::hasher
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::hash_function() const {
+  return _hash;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::key_equal
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::key_eq() const {
+  return _equal;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+std::int8_t flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::h2(
+    std::uint64_t hash) noexcept {
+  return static_cast<std::int8_t>(hash & 0x7f);
+}
+
+// std::hash of an integer is the identity, so the result is mixed before
+// its low seven bits go to the control byte and the rest pick the slot.
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+std::uint64_t flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::hash_of(
+    const Key &key) const {
+  std::uint64_t hash =
+      static_cast<std::uint64_t>(_hash(key)) * 0x9e3779b97f4a7c15ULL;
+  return hash ^ (hash >> 32);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::home(
+    std::uint64_t hash) const noexcept {
+  return static_cast<size_type>(hash >> 7) & (capacity() - 1);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::value_type *
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::element(
+    size_type pos) noexcept {
+  return &_slots[pos].value;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+const typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::value_type *
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::element(
+    size_type pos) const noexcept {
+  return &_slots[pos].value;
+}
+
+// Walks the probe run from the key's home slot a group at a time. Elements
+// never sit behind an empty slot of their run, so the first group with an
+// empty slot ends the search. Returns capacity() when the key is absent.
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::find_index(
+    const Key &key) const {
+  if (_size == 0) return capacity();
+  std::uint64_t hash = hash_of(key);
+  size_type mask = capacity() - 1;
+  for (size_type pos = home(hash);; pos = (pos + hash_group::width) & mask) {
+    hash_group group(_ctrl.data() + pos);
+    for (std::uint32_t match = group.match(h2(hash)); match;
+         match &= match - 1) {
+      size_type index = (pos + __builtin_ctz(match)) & mask;
+      if (_equal(element(index)->first, key)) return index;
+    }
+    if (group.match_empty()) return capacity();
+  }
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::find_empty(
+    std::uint64_t hash) const noexcept {
+  size_type mask = capacity() - 1;
+  for (size_type pos = home(hash);; pos = (pos + hash_group::width) & mask) {
+    std::uint32_t empty = hash_group(_ctrl.data() + pos).match_empty();
+    if (empty) return (pos + __builtin_ctz(empty)) & mask;
+  }
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::next_full(
+    size_type pos) const noexcept {
+  for (; pos < capacity(); pos += hash_group::width) {
+    std::uint32_t full = hash_group(_ctrl.data() + pos).match_full();
+    if (full) return std::min<size_type>(pos + __builtin_ctz(full), capacity());
+  }
+  return capacity();
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::growth_limit(
+    size_type capacity) const noexcept {
+  return static_cast<size_type>(static_cast<double>(capacity) * _max_load);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::size_type
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::capacity_for(
+    size_type count) const noexcept {
+  size_type capacity = hash_group::width;
+  while (growth_limit(capacity) < count) capacity *= 2;
+  return capacity;
+}
+
+// The first width - 1 control bytes are mirrored past the end, so a group
+// load that starts near the end of the table sees the wrapped slots.
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::set_ctrl(
+    size_type pos, std::int8_t value) noexcept {
+  _ctrl[pos] = value;
+  _ctrl[((pos - (hash_group::width - 1)) & (capacity() - 1)) +
+        (hash_group::width - 1)] = value;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <class K, class... Args>
+std::pair<typename flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::iterator,
+          bool>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::emplace_key(
+    K &&key, Args &&...args) {
+  size_type pos = find_index(key);
+  if (pos != capacity()) return {iterator(this, pos), false};
+  if (_size >= _growth_limit) resize_table(capacity_for(_size + 1));
+  std::uint64_t hash = hash_of(key);
+  pos = find_empty(hash);
+  allocator_traits::construct(
+      _allocator, element(pos), std::piecewise_construct,
+      std::forward_as_tuple(std::forward<K>(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  set_ctrl(pos, h2(hash));
+  ++_size;
+  return {iterator(this, pos), true};
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::relocate(
+    slot &from, slot &to) noexcept {
+  allocator_traits::construct(_allocator, &to.mutable_value,
+                              std::move(from.mutable_value));
+  allocator_traits::destroy(_allocator, &from.mutable_value);
+}
+
+// Backward-shift deletion: every later element of the probe run whose home
+// slot is not between the hole and itself moves back into the hole, which
+// keeps runs free of gaps without tombstones. A hasher that may throw is run
+// over the rest of the probe run before the element is destroyed, so a
+// failure leaves the map untouched.
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::erase_at(
+    size_type pos) {
+  constexpr bool nothrow_hash =
+      std::is_nothrow_invocable_v<const Hash &, const Key &>;
+  size_type mask = capacity() - 1;
+  hash_allocator hash_alloc(_allocator);
+  vector<std::uint64_t, hash_allocator> hashes(hash_alloc);
+  if constexpr (!nothrow_hash) {
+    for (size_type next = (pos + 1) & mask; _ctrl[next] != hash_group::empty;
+         next = (next + 1) & mask)
+      hashes.push_back(hash_of(element(next)->first));
+  }
+  allocator_traits::destroy(_allocator, element(pos));
+  --_size;
+  size_type hole = pos;
+  size_type run = 0;
+  for (size_type next = (hole + 1) & mask; _ctrl[next] != hash_group::empty;
+       next = (next + 1) & mask) {
+    std::uint64_t hash;
+    if constexpr (nothrow_hash)
+      hash = hash_of(element(next)->first);
+    else
+      hash = hashes[run++];
+    size_type next_home = home(hash);
+    if (((next - next_home) & mask) < ((next - hole) & mask)) continue;
+    relocate(_slots[next], _slots[hole]);
+    set_ctrl(hole, _ctrl[next]);
+    hole = next;
+  }
+  set_ctrl(hole, hash_group::empty);
+}
+
+// Both new arrays are allocated before anything moves, so a failed
+// allocation leaves the map untouched. A hasher that may throw is run over
+// every element first, for the same reason.
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::resize_table(
+    size_type new_capacity) {
+  constexpr bool nothrow_hash =
+      std::is_nothrow_invocable_v<const Hash &, const Key &>;
+  ctrl_allocator ctrl_alloc(_allocator);
+  slot_allocator slot_alloc(_allocator);
+  hash_allocator hash_alloc(_allocator);
+  vector<std::int8_t, ctrl_allocator> ctrl(ctrl_alloc);
+  vector<slot, slot_allocator> slots(slot_alloc);
+  vector<std::uint64_t, hash_allocator> hashes(hash_alloc);
+  if (new_capacity > 0) {
+    ctrl.resize(new_capacity + hash_group::width - 1, hash_group::empty);
+    slots.resize_for_overwrite(new_capacity);
+  }
+  if constexpr (!nothrow_hash) {
+    hashes.reserve(_size);
+    for (size_type pos = next_full(0); pos < capacity();
+         pos = next_full(pos + 1))
+      hashes.push_back(hash_of(element(pos)->first));
+  }
+  _ctrl.swap(ctrl);
+  _slots.swap(slots);
+  _growth_limit = growth_limit(new_capacity);
+  size_type moved = 0;
+  for (size_type pos = 0; pos < slots.size(); ++pos) {
+    if (ctrl[pos] == hash_group::empty) continue;
+    std::uint64_t hash;
+    if constexpr (nothrow_hash)
+      hash = hash_of(slots[pos].value.first);
+    else
+      hash = hashes[moved++];
+    size_type to = find_empty(hash);
+    relocate(slots[pos], _slots[to]);
+    set_ctrl(to, ctrl[pos]);
+  }
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::destroy_elements()
+    noexcept {
+  if constexpr (!std::is_trivially_destructible_v<value_type>) {
+    for (size_type pos = next_full(0); pos < capacity();
+         pos = next_full(pos + 1))
+      allocator_traits::destroy(_allocator, element(pos));
+  }
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+void flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::steal(
+    flat_hash_map &other) noexcept {
+  destroy_elements();
+  _ctrl = std::move(other._ctrl);
+  _slots = std::move(other._slots);
+  _size = other._size;
+  _growth_limit = other._growth_limit;
+  _max_load = other._max_load;
+  _hash = std::move(other._hash);
+  _equal = std::move(other._equal);
+  if constexpr (allocator_traits::propagate_on_container_move_assignment::
+                    value)
+    _allocator = std::move(other._allocator);
+  other._size = 0;
+  other._growth_limit = 0;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::common_iterator(container_type *map, size_t pos) noexcept
+    : _map(map), _pos(pos) {}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::common_iterator() noexcept
+    : _map(nullptr), _pos(0) {}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::operator common_iterator<true>() const noexcept {
+  return common_iterator<true>(_map, _pos);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+typename flat_hash_map<Key, T, Hash, KeyEqual,
+                       Allocator>::template common_iterator<IsConst>::reference
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::operator*() const {
+  return *_map->element(_pos);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+typename flat_hash_map<Key, T, Hash, KeyEqual,
+                       Allocator>::template common_iterator<IsConst>::pointer
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::operator->() const {
+  return _map->element(_pos);
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+typename flat_hash_map<Key, T, Hash, KeyEqual,
+                       Allocator>::template common_iterator<IsConst> &
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::operator++() {
+  _pos = _map->next_full(_pos + 1);
+  return *this;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+typename flat_hash_map<Key, T, Hash, KeyEqual,
+                       Allocator>::template common_iterator<IsConst>
+flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::operator++(int) {
+  common_iterator result = *this;
+  ++*this;
+  return result;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+bool flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::operator==(const common_iterator<true> &other) const noexcept {
+  return _pos == other._pos;
+}
+
+template <class Key, class T, class Hash, class KeyEqual, class Allocator>
+template <bool IsConst>
+bool flat_hash_map<Key, T, Hash, KeyEqual, Allocator>::common_iterator<
+    IsConst>::operator!=(const common_iterator<true> &other) const noexcept {
+  return _pos != other._pos;
+}
+
+}  // namespace s21
+
+#endif  // S21_FLAT_HASH_MAP_H_
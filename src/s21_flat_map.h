@@ -0,0 +1,665 @@
+#ifndef S21_FLAT_MAP_H_
+#define S21_FLAT_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_flat_set.h"
+#include "s21_span.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Sorted map stored as two parallel s21::vectors: the binary search only
+// touches the key column, and a pass over the values streams through memory
+// that holds nothing else. Entries are read through pairs of references.
+template <class Key, class T, class Compare = std::less<Key>>
+class flat_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using key_compare = Compare;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::pair<const Key &, T &>;
+  using const_reference = std::pair<const Key &, const T &>;
+
+ private:
+  template <bool IsConst>
+  class pair_iterator {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, T>;
+    using reference = std::conditional_t<IsConst, flat_map::const_reference,
+                                         flat_map::reference>;
+    using pointer = void;
+    using iterator_category = std::random_access_iterator_tag;
+    using container_type =
+        std::conditional_t<IsConst, const flat_map, flat_map>;
+
+    template <bool IsConstFriend>
+    friend class pair_iterator;
+
+    pair_iterator(container_type *map, size_type pos) noexcept;
+    pair_iterator() noexcept;
+
+    operator pair_iterator<true>() const noexcept;
+
+    reference operator*() const;
+    reference operator[](difference_type n) const;
+
+    pair_iterator &operator++();
+    pair_iterator &operator--();
+    pair_iterator operator++(int);
+    pair_iterator operator--(int);
+    pair_iterator operator+(difference_type n) const;
+    pair_iterator operator-(difference_type n) const;
+    pair_iterator &operator+=(difference_type n);
+    pair_iterator &operator-=(difference_type n);
+    difference_type operator-(const pair_iterator<true> &other) const;
+
+    bool operator==(const pair_iterator<true> &other) const noexcept;
+    bool operator!=(const pair_iterator<true> &other) const noexcept;
+    bool operator<(const pair_iterator<true> &other) const noexcept;
+
+   private:
+    container_type *_map;
+    size_type _pos;
+  };
+
+ public:
+  using iterator = pair_iterator<false>;
+  using const_iterator = pair_iterator<true>;
+
+  flat_map();
+  explicit flat_map(const Compare &comp);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  flat_map(InputIt first, InputIt last, const Compare &comp = Compare());
+  flat_map(std::initializer_list<value_type> init,
+           const Compare &comp = Compare());
+
+  T &at(const Key &key);
+  const T &at(const Key &key) const;
+  T &operator[](const Key &key);
+  T &operator[](Key &&key);
+  span<const Key> keys() const noexcept;
+  span<T> values() noexcept;
+  span<const T> values() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  void insert(InputIt first, InputIt last);
+  void insert(std::initializer_list<value_type> ilist);
+  template <class M>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, M &&obj);
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+  iterator erase(const_iterator pos);
+  size_type erase(const Key &key);
+  void swap(flat_map &other) noexcept;
+
+  size_type count(const Key &key) const;
+  iterator find(const Key &key);
+  const_iterator find(const Key &key) const;
+  bool contains(const Key &key) const;
+  iterator lower_bound(const Key &key);
+  const_iterator lower_bound(const Key &key) const;
+  iterator upper_bound(const Key &key);
+  const_iterator upper_bound(const Key &key) const;
+
+  key_compare key_comp() const;
+
+ private:
+  size_type lower_index(const Key &key) const;
+  size_type find_index(const Key &key) const;
+  size_type upper_index(const Key &key) const;
+  template <class K, class... Args>
+  std::pair<iterator, bool> emplace_key(K &&key, Args &&...args);
+
+  vector<Key> _keys;
+  vector<T> _values;
+  Compare _comp;
+};
+
+template <class Key, class T, class Compare>
+flat_map<Key, T, Compare>::flat_map() : _keys(), _values(), _comp() {}
+
+template <class Key, class T, class Compare>
+flat_map<Key, T, Compare>::flat_map(const Compare &comp)
+    : _keys(), _values(), _comp(comp) {}
+
+template <class Key, class T, class Compare>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+flat_map<Key, T, Compare>::flat_map(InputIt first, InputIt last,
+                                    const Compare &comp)
+    : _keys(), _values(), _comp(comp) {
+  insert(first, last);
+}
+
+template <class Key, class T, class Compare>
+flat_map<Key, T, Compare>::flat_map(std::initializer_list<value_type> init,
+                                    const Compare &comp)
+    : _keys(), _values(), _comp(comp) {
+  insert(init.begin(), init.end());
+}
+
+template <class Key, class T, class Compare>
+T &flat_map<Key, T, Compare>::at(const Key &key) {
+  size_type pos = find_index(key);
+  if (pos == size()) throw std::out_of_range("Key not found");
+  return _values[pos];
+}
+
+template <class Key, class T, class Compare>
+const T &flat_map<Key, T, Compare>::at(const Key &key) const {
+  size_type pos = find_index(key);
+  if (pos == size()) throw std::out_of_range("Key not found");
+  return _values[pos];
+}
+
+template <class Key, class T, class Compare>
+T &flat_map<Key, T, Compare>::operator[](const Key &key) {
+  return (*try_emplace(key).first).second;
+}
+
+template <class Key, class T, class Compare>
+T &flat_map<Key, T, Compare>::operator[](Key &&key) {
+  return (*try_emplace(std::move(key)).first).second;
+}
+
+template <class Key, class T, class Compare>
+span<const Key> flat_map<Key, T, Compare>::keys() const noexcept {
+  return span<const Key>(_keys.data(), _keys.size());
+}
+
+template <class Key, class T, class Compare>
+span<T> flat_map<Key, T, Compare>::values() noexcept {
+  return span<T>(_values.data(), _values.size());
+}
+
+template <class Key, class T, class Compare>
+span<const T> flat_map<Key, T, Compare>::values() const noexcept {
+  return span<const T>(_values.data(), _values.size());
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::begin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::cbegin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::end() noexcept {
+  return iterator(this, size());
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::end() const noexcept {
+  return const_iterator(this, size());
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::cend() const noexcept {
+  return const_iterator(this, size());
+}
+
+template <class Key, class T, class Compare>
+bool flat_map<Key, T, Compare>::empty() const noexcept {
+  return _keys.empty();
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::size() const noexcept {
+  return _keys.size();
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::max_size() const noexcept {
+  return std::min(_keys.max_size(), _values.max_size());
+}
+
+template <class Key, class T, class Compare>
+void flat_map<Key, T, Compare>::reserve(size_type new_cap) {
+  _keys.reserve(new_cap);
+  _values.reserve(new_cap);
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::capacity() const noexcept {
+  return std::min(_keys.capacity(), _values.capacity());
+}
+
+template <class Key, class T, class Compare>
+void flat_map<Key, T, Compare>::shrink_to_fit() {
+  _keys.shrink_to_fit();
+  _values.shrink_to_fit();
+}
+
+template <class Key, class T, class Compare>
+void flat_map<Key, T, Compare>::clear() noexcept {
+  _keys.clear();
+  _values.clear();
+}
+
+template <class Key, class T, class Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert(const value_type &value) {
+  return emplace_key(value.first, value.second);
+}
+
+template <class Key, class T, class Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert(value_type &&value) {
+  return emplace_key(std::move(value.first), std::move(value.second));
+}
+
+// Appends both columns, sorts the new tail through an index permutation and
+// merges it with the existing entries into fresh columns in one pass. The
+// sort is stable and existing keys come first on ties, so the first
+// occurrence of a key wins, as with repeated insert(). Entries are moved
+// only when neither the columns nor the comparator can throw during the
+// merge, otherwise both columns are copied, so a failure leaves the old
+// entries intact and only drops the appended tail. Move-only entries are
+// always moved and get the basic guarantee only.
+template <class Key, class T, class Compare>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+void flat_map<Key, T, Compare>::insert(InputIt first, InputIt last) {
+  constexpr bool move_entries =
+      (std::is_nothrow_move_constructible_v<Key> &&
+       std::is_nothrow_move_constructible_v<T> &&
+       std::is_nothrow_invocable_v<Compare &, const Key &, const Key &>) ||
+      !std::is_copy_constructible_v<Key> || !std::is_copy_constructible_v<T>;
+  size_type old_size = size();
+  try {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                          typename std::iterator_traits<
+                              InputIt>::iterator_category>)
+      reserve(old_size + std::distance(first, last));
+    for (; first != last; ++first) {
+      auto &&entry = *first;
+      _keys.push_back(entry.first);
+      _values.push_back(entry.second);
+    }
+    size_type added = size() - old_size;
+    if (added == 0) return;
+    vector<size_type> order(added);
+    std::iota(order.begin(), order.end(), old_size);
+    std::stable_sort(order.begin(), order.end(),
+                     [this](size_type lhs, size_type rhs) {
+                       return _comp(_keys[lhs], _keys[rhs]);
+                     });
+    vector<Key> keys;
+    vector<T> values;
+    keys.reserve(size());
+    values.reserve(size());
+    size_type old_pos = 0;
+    size_type new_pos = 0;
+    while (old_pos < old_size || new_pos < added) {
+      bool take_old =
+          new_pos == added ||
+          (old_pos < old_size && !_comp(_keys[order[new_pos]], _keys[old_pos]));
+      size_type from = take_old ? old_pos++ : order[new_pos++];
+      if (!keys.empty() && !_comp(keys.back(), _keys[from])) continue;
+      if constexpr (move_entries) {
+        keys.push_back(std::move(_keys[from]));
+        values.push_back(std::move(_values[from]));
+      } else {
+        keys.push_back(_keys[from]);
+        values.push_back(_values[from]);
+      }
+    }
+    _keys.swap(keys);
+    _values.swap(values);
+  } catch (...) {
+    _keys.erase(_keys.begin() + old_size, _keys.end());
+    if (_values.size() > old_size)
+      _values.erase(_values.begin() + old_size, _values.end());
+    throw;
+  }
+}
+
+template <class Key, class T, class Compare>
+void flat_map<Key, T, Compare>::insert(
+    std::initializer_list<value_type> ilist) {
+  insert(ilist.begin(), ilist.end());
+}
+
+template <class Key, class T, class Compare>
+template <class M>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert_or_assign(const Key &key, M &&obj) {
+  size_type pos = find_index(key);
+  if (pos != size()) {
+    _values[pos] = std::forward<M>(obj);
+    return {iterator(this, pos), false};
+  }
+  return emplace_key(key, std::forward<M>(obj));
+}
+
+template <class Key, class T, class Compare>
+template <class... Args>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::emplace(Args &&...args) {
+  return insert(value_type(std::forward<Args>(args)...));
+}
+
+template <class Key, class T, class Compare>
+template <class... Args>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::try_emplace(const Key &key, Args &&...args) {
+  return emplace_key(key, std::forward<Args>(args)...);
+}
+
+template <class Key, class T, class Compare>
+template <class... Args>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::try_emplace(Key &&key, Args &&...args) {
+  return emplace_key(std::move(key), std::forward<Args>(args)...);
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::erase(
+    const_iterator pos) {
+  size_type index = pos - cbegin();
+  _keys.erase(_keys.cbegin() + index);
+  _values.erase(_values.cbegin() + index);
+  return iterator(this, index);
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::erase(const Key &key) {
+  size_type pos = find_index(key);
+  if (pos == size()) return 0;
+  erase(const_iterator(this, pos));
+  return 1;
+}
+
+template <class Key, class T, class Compare>
+void flat_map<Key, T, Compare>::swap(flat_map &other) noexcept {
+  _keys.swap(other._keys);
+  _values.swap(other._values);
+  std::swap(_comp, other._comp);
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::count(const Key &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::find(
+    const Key &key) {
+  return iterator(this, find_index(key));
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::find(const Key &key) const {
+  return const_iterator(this, find_index(key));
+}
+
+template <class Key, class T, class Compare>
+bool flat_map<Key, T, Compare>::contains(const Key &key) const {
+  return find_index(key) != size();
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::lower_bound(const Key &key) {
+  return iterator(this, lower_index(key));
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::lower_bound(const Key &key) const {
+  return const_iterator(this, lower_index(key));
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::upper_bound(const Key &key) {
+  return iterator(this, upper_index(key));
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::const_iterator
+flat_map<Key, T, Compare>::upper_bound(const Key &key) const {
+  return const_iterator(this, upper_index(key));
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::key_compare
+flat_map<Key, T, Compare>::key_comp() const {
+  return _comp;
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::lower_index(const Key &key) const {
+  return branchless_lower_bound(_keys.data(), _keys.size(), key, _comp) -
+         _keys.data();
+}
+
+// Returns size() when the key is absent.
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::find_index(const Key &key) const {
+  size_type pos = lower_index(key);
+  if (pos != size() && _comp(key, _keys[pos])) return size();
+  return pos;
+}
+
+template <class Key, class T, class Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::upper_index(const Key &key) const {
+  size_type pos = lower_index(key);
+  return pos != size() && !_comp(key, _keys[pos]) ? pos + 1 : pos;
+}
+
+// The mapped value is built before anything is inserted, and the key is
+// taken out again if the value column fails to grow, so both columns stay
+// the same length.
+template <class Key, class T, class Compare>
+template <class K, class... Args>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::emplace_key(K &&key, Args &&...args) {
+  size_type pos = lower_index(key);
+  if (pos != size() && !_comp(key, _keys[pos]))
+    return {iterator(this, pos), false};
+  T value(std::forward<Args>(args)...);
+  _keys.insert(_keys.cbegin() + pos, std::forward<K>(key));
+  try {
+    _values.insert(_values.cbegin() + pos, std::move(value));
+  } catch (...) {
+    _keys.erase(_keys.cbegin() + pos);
+    throw;
+  }
+  return {iterator(this, pos), true};
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::pair_iterator(
+    container_type *map, size_type pos) noexcept
+    : _map(map), _pos(pos) {}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::pair_iterator() noexcept
+    : _map(nullptr), _pos(0) {}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator pair_iterator<
+    true>() const noexcept {
+  return pair_iterator<true>(_map, _pos);
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst>::reference
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator*() const {
+  return reference(_map->_keys[_pos], _map->_values[_pos]);
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst>::reference
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator[](
+    difference_type n) const {
+  return reference(_map->_keys[_pos + n], _map->_values[_pos + n]);
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst> &
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator++() {
+  ++_pos;
+  return *this;
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst> &
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator--() {
+  --_pos;
+  return *this;
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst>
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator++(int) {
+  pair_iterator result = *this;
+  ++_pos;
+  return result;
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst>
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator--(int) {
+  pair_iterator result = *this;
+  --_pos;
+  return result;
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst>
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator+(
+    difference_type n) const {
+  return pair_iterator(_map, _pos + n);
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst>
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator-(
+    difference_type n) const {
+  return pair_iterator(_map, _pos - n);
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst> &
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator+=(
+    difference_type n) {
+  _pos += n;
+  return *this;
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<IsConst> &
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator-=(
+    difference_type n) {
+  _pos -= n;
+  return *this;
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+typename flat_map<Key, T, Compare>::template pair_iterator<
+    IsConst>::difference_type
+flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator-(
+    const pair_iterator<true> &other) const {
+  return static_cast<difference_type>(_pos) -
+         static_cast<difference_type>(other._pos);
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+bool flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator==(
+    const pair_iterator<true> &other) const noexcept {
+  return _pos == other._pos;
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+bool flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator!=(
+    const pair_iterator<true> &other) const noexcept {
+  return _pos != other._pos;
+}
+
+template <class Key, class T, class Compare>
+template <bool IsConst>
+bool flat_map<Key, T, Compare>::pair_iterator<IsConst>::operator<(
+    const pair_iterator<true> &other) const noexcept {
+  return _pos < other._pos;
+}
+
+}  // namespace s21
+
+#endif  // S21_FLAT_MAP_H_
@@ -0,0 +1,377 @@
+#ifndef S21_FLAT_SET_H_
+#define S21_FLAT_SET_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Lower bound over count sorted elements. Each step halves the range with a
+// conditional move instead of a branch, so lookups in small and medium
+// tables do not pay for mispredicted comparisons.
+template <class T, class Key, class Compare>
+const T *branchless_lower_bound(const T *first, std::size_t count,
+                                const Key &key, Compare comp) {
+  if (count == 0) return first;
+  while (count > 1) {
+    std::size_t half = count / 2;
+    first = comp(first[half], key) ? first + half : first;
+    count -= half;
+  }
+  return first + comp(*first, key);
+}
+
+// Sorted set stored in one s21::vector. Lookups are binary searches over
+// contiguous keys; single inserts shift the tail, so bulk loads should go
+// through insert(first, last), which appends, sorts and merges once.
+template <class Key, class Compare = std::less<Key>,
+          class Container = vector<Key>>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using container_type = Container;
+  using size_type = typename Container::size_type;
+  using difference_type = typename Container::difference_type;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename Container::const_iterator;
+  using const_iterator = typename Container::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  flat_set();
+  explicit flat_set(const Compare &comp);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  flat_set(InputIt first, InputIt last, const Compare &comp = Compare());
+  flat_set(std::initializer_list<value_type> init,
+           const Compare &comp = Compare());
+
+  iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+  reverse_iterator rbegin() const noexcept;
+  const_reverse_iterator crbegin() const noexcept;
+  reverse_iterator rend() const noexcept;
+  const_reverse_iterator crend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+  const container_type &keys() const noexcept;
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(value_type &&value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  void insert(InputIt first, InputIt last);
+  void insert(std::initializer_list<value_type> ilist);
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &key);
+  void swap(flat_set &other) noexcept;
+
+  size_type count(const key_type &key) const;
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const;
+
+  key_compare key_comp() const;
+  value_compare value_comp() const;
+
+ private:
+  size_type lower_index(const key_type &key) const;
+
+  Container _keys;
+  Compare _comp;
+};
+
+template <class Key, class Compare, class Container>
+flat_set<Key, Compare, Container>::flat_set() : _keys(), _comp() {}
+
+template <class Key, class Compare, class Container>
+flat_set<Key, Compare, Container>::flat_set(const Compare &comp)
+    : _keys(), _comp(comp) {}
+
+template <class Key, class Compare, class Container>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+flat_set<Key, Compare, Container>::flat_set(InputIt first, InputIt last,
+                                            const Compare &comp)
+    : _keys(), _comp(comp) {
+  insert(first, last);
+}
+
+template <class Key, class Compare, class Container>
+flat_set<Key, Compare, Container>::flat_set(
+    std::initializer_list<value_type> init, const Compare &comp)
+    : _keys(), _comp(comp) {
+  insert(init.begin(), init.end());
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::iterator
+flat_set<Key, Compare, Container>::begin() const noexcept {
+  return _keys.cbegin();
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::const_iterator
+flat_set<Key, Compare, Container>::cbegin() const noexcept {
+  return _keys.cbegin();
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::iterator
+flat_set<Key, Compare, Container>::end() const noexcept {
+  return _keys.cend();
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::const_iterator
+flat_set<Key, Compare, Container>::cend() const noexcept {
+  return _keys.cend();
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::reverse_iterator
+flat_set<Key, Compare, Container>::rbegin() const noexcept {
+  return reverse_iterator(end());
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::const_reverse_iterator
+flat_set<Key, Compare, Container>::crbegin() const noexcept {
+  return const_reverse_iterator(cend());
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::reverse_iterator
+flat_set<Key, Compare, Container>::rend() const noexcept {
+  return reverse_iterator(begin());
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::const_reverse_iterator
+flat_set<Key, Compare, Container>::crend() const noexcept {
+  return const_reverse_iterator(cbegin());
+}
+
+template <class Key, class Compare, class Container>
+bool flat_set<Key, Compare, Container>::empty() const noexcept {
+  return _keys.empty();
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::size_type
+flat_set<Key, Compare, Container>::size() const noexcept {
+  return _keys.size();
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::size_type
+flat_set<Key, Compare, Container>::max_size() const noexcept {
+  return _keys.max_size();
+}
+
+template <class Key, class Compare, class Container>
+void flat_set<Key, Compare, Container>::reserve(size_type new_cap) {
+  _keys.reserve(new_cap);
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::size_type
+flat_set<Key, Compare, Container>::capacity() const noexcept {
+  return _keys.capacity();
+}
+
+template <class Key, class Compare, class Container>
+void flat_set<Key, Compare, Container>::shrink_to_fit() {
+  _keys.shrink_to_fit();
+}
+
+template <class Key, class Compare, class Container>
+const typename flat_set<Key, Compare, Container>::container_type &
+flat_set<Key, Compare, Container>::keys() const noexcept {
+  return _keys;
+}
+
+template <class Key, class Compare, class Container>
+void flat_set<Key, Compare, Container>::clear() noexcept {
+  _keys.clear();
+}
+
+template <class Key, class Compare, class Container>
+std::pair<typename flat_set<Key, Compare, Container>::iterator, bool>
+flat_set<Key, Compare, Container>::insert(const value_type &value) {
+  return emplace(value);
+}
+
+template <class Key, class Compare, class Container>
+std::pair<typename flat_set<Key, Compare, Container>::iterator, bool>
+flat_set<Key, Compare, Container>::insert(value_type &&value) {
+  return emplace(std::move(value));
+}
+
+// Appends the whole range, sorts only the new tail and merges it with the
+// existing keys into a fresh buffer, so n inserts cost one sort and one pass
+// instead of n shifts. Keys already present win over equivalent new ones,
+// and within the range the first of several equivalent keys is kept.
+// Keys are moved only when neither moving them nor comparing them can throw,
+// which keeps the strong exception guarantee: on failure the appended tail
+// is dropped again. Move-only keys get the basic guarantee only.
+template <class Key, class Compare, class Container>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+void flat_set<Key, Compare, Container>::insert(InputIt first, InputIt last) {
+  constexpr bool move_keys =
+      (std::is_nothrow_move_constructible_v<Key> &&
+       std::is_nothrow_invocable_v<Compare &, const Key &, const Key &>) ||
+      !std::is_copy_constructible_v<Key>;
+  size_type old_size = _keys.size();
+  try {
+    _keys.append(first, last);
+    if (_keys.size() == old_size) return;
+    std::stable_sort(_keys.begin() + old_size, _keys.end(), _comp);
+    Container merged(_keys.get_allocator());
+    merged.reserve(_keys.size());
+    size_type old_pos = 0;
+    size_type new_pos = old_size;
+    while (old_pos < old_size || new_pos < _keys.size()) {
+      bool take_old = new_pos == _keys.size() ||
+                      (old_pos < old_size &&
+                       !_comp(_keys[new_pos], _keys[old_pos]));
+      Key &key = take_old ? _keys[old_pos++] : _keys[new_pos++];
+      if (!merged.empty() && !_comp(merged.back(), key)) continue;
+      if constexpr (move_keys)
+        merged.push_back(std::move(key));
+      else
+        merged.push_back(key);
+    }
+    _keys.swap(merged);
+  } catch (...) {
+    _keys.erase(_keys.begin() + old_size, _keys.end());
+    throw;
+  }
+}
+
+template <class Key, class Compare, class Container>
+void flat_set<Key, Compare, Container>::insert(
+    std::initializer_list<value_type> ilist) {
+  insert(ilist.begin(), ilist.end());
+}
+
+template <class Key, class Compare, class Container>
+template <class... Args>
+std::pair<typename flat_set<Key, Compare, Container>::iterator, bool>
+flat_set<Key, Compare, Container>::emplace(Args &&...args) {
+  Key key(std::forward<Args>(args)...);
+  size_type pos = lower_index(key);
+  if (pos != _keys.size() && !_comp(key, _keys[pos]))
+    return {begin() + pos, false};
+  return {_keys.insert(_keys.cbegin() + pos, std::move(key)), true};
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::iterator
+flat_set<Key, Compare, Container>::erase(const_iterator pos) {
+  difference_type index = pos - cbegin();
+  _keys.erase(pos);
+  return begin() + index;
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::size_type
+flat_set<Key, Compare, Container>::erase(const key_type &key) {
+  iterator pos = find(key);
+  if (pos == end()) return 0;
+  erase(pos);
+  return 1;
+}
+
+template <class Key, class Compare, class Container>
+void flat_set<Key, Compare, Container>::swap(flat_set &other) noexcept {
+  _keys.swap(other._keys);
+  std::swap(_comp, other._comp);
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::size_type
+flat_set<Key, Compare, Container>::count(const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::iterator
+flat_set<Key, Compare, Container>::find(const key_type &key) const {
+  size_type pos = lower_index(key);
+  if (pos != _keys.size() && !_comp(key, _keys[pos])) return begin() + pos;
+  return end();
+}
+
+template <class Key, class Compare, class Container>
+bool flat_set<Key, Compare, Container>::contains(const key_type &key) const {
+  return find(key) != end();
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::iterator
+flat_set<Key, Compare, Container>::lower_bound(const key_type &key) const {
+  return begin() + lower_index(key);
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::iterator
+flat_set<Key, Compare, Container>::upper_bound(const key_type &key) const {
+  iterator pos = find(key);
+  return pos == end() ? lower_bound(key) : pos + 1;
+}
+
+template <class Key, class Compare, class Container>
+std::pair<typename flat_set<Key, Compare, Container>::iterator,
+          typename flat_set<Key, Compare, Container>::iterator>
+flat_set<Key, Compare, Container>::equal_range(const key_type &key) const {
+  iterator first = lower_bound(key);
+  if (first != end() && !_comp(key, *first)) return {first, first + 1};
+  return {first, first};
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::key_compare
+flat_set<Key, Compare, Container>::key_comp() const {
+  return _comp;
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::value_compare
+flat_set<Key, Compare, Container>::value_comp() const {
+  return _comp;
+}
+
+template <class Key, class Compare, class Container>
+typename flat_set<Key, Compare, Container>::size_type
+flat_set<Key, Compare, Container>::lower_index(const key_type &key) const {
+  return branchless_lower_bound(_keys.data(), _keys.size(), key, _comp) -
+         _keys.data();
+}
+
+}  // namespace s21
+
+#endif  // S21_FLAT_SET_H_
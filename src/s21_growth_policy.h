@@ -0,0 +1,94 @@
+#ifndef S21_GROWTH_POLICY_H_
+#define S21_GROWTH_POLICY_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// A growth policy tells a vector which capacity to allocate when it runs out
+// of room. next_capacity<T>(capacity, required) gets the current capacity and
+// the smallest capacity that fits the pending insertion; the vector clamps
+// the answer to [required, max_size()].
+
+struct doubling_growth {
+  template <class T>
+  static std::size_t next_capacity(std::size_t capacity,
+                                   std::size_t required) noexcept;
+};
+
+struct one_and_half_growth {
+  template <class T>
+  static std::size_t next_capacity(std::size_t capacity,
+                                   std::size_t required) noexcept;
+};
+
+// Grows by half and rounds the block up to the allocator's size class:
+// quarter-power-of-two classes below a page, whole pages above it. The
+// rounding slack would be lost to the allocator anyway, so it becomes
+// usable capacity instead.
+template <std::size_t PageSize = 4096>
+struct size_class_growth {
+  template <class T>
+  static std::size_t next_capacity(std::size_t capacity,
+                                   std::size_t required) noexcept;
+  static std::size_t round_to_size_class(std::size_t bytes) noexcept;
+};
+
+// Doubles while the step is smaller than MaxStepBytes and then grows by a
+// fixed MaxStepBytes, bounding the slack of huge buffers.
+template <std::size_t MaxStepBytes = 64 * 1024 * 1024>
+struct capped_growth {
+  template <class T>
+  static std::size_t next_capacity(std::size_t capacity,
+                                   std::size_t required) noexcept;
+};
+
+template <class T>
+std::size_t doubling_growth::next_capacity(std::size_t capacity,
+                                           std::size_t required) noexcept {
+  std::size_t result = capacity * 2;
+  return result < required ? required : result;
+}
+
+template <class T>
+std::size_t one_and_half_growth::next_capacity(std::size_t capacity,
+                                               std::size_t required) noexcept {
+  std::size_t result = capacity + capacity / 2;
+  return result < required ? required : result;
+}
+
+template <std::size_t PageSize>
+template <class T>
+std::size_t size_class_growth<PageSize>::next_capacity(
+    std::size_t capacity, std::size_t required) noexcept {
+  std::size_t result = capacity + capacity / 2;
+  if (result < required) result = required;
+  result = round_to_size_class(result * sizeof(T)) / sizeof(T);
+  return result < required ? required : result;
+}
+
+template <std::size_t PageSize>
+std::size_t size_class_growth<PageSize>::round_to_size_class(
+    std::size_t bytes) noexcept {
+  if (bytes <= 16) return 16;
+  if (bytes >= PageSize) return (bytes + PageSize - 1) / PageSize * PageSize;
+  std::size_t spacing = 1;
+  while (spacing <= (bytes - 1) / 2) spacing *= 2;
+  spacing /= 4;
+  if (spacing < 16) spacing = 16;
+  return (bytes + spacing - 1) / spacing * spacing;
+}
+
+template <std::size_t MaxStepBytes>
+template <class T>
+std::size_t capped_growth<MaxStepBytes>::next_capacity(
+    std::size_t capacity, std::size_t required) noexcept {
+  std::size_t max_step = MaxStepBytes / sizeof(T);
+  if (max_step == 0) max_step = 1;
+  std::size_t result = capacity + (capacity < max_step ? capacity : max_step);
+  return result < required ? required : result;
+}
+
+}  // namespace s21
+
+#endif  // S21_GROWTH_POLICY_H_
@@ -0,0 +1,853 @@
+#ifndef S21_INCREMENTAL_VECTOR_H_
+#define S21_INCREMENTAL_VECTOR_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
+#include "s21_memory.h"
+
+namespace s21 {
+
+// Vector whose growth is spread over time instead of paid in one push_back.
+// When capacity runs out it allocates the new buffer, constructs the new
+// element there and leaves the old elements where they are; every following
+// push_back then migrates at least MigrationStep of them. Until the
+// migration is done, indexing resolves each position to whichever buffer
+// holds it. The step is raised when needed so the migration always finishes
+// before the new buffer fills up, which bounds the work of any single
+// push_back to one allocation plus a fixed number of element moves.
+//
+// Storage is contiguous only once migrating() is false, so there is no
+// data(); iterators hold the container and an index.
+template <class T, class Allocator = std::allocator<T>,
+          class GrowthPolicy = doubling_growth,
+          std::size_t MigrationStep = 16>
+class incremental_vector {
+  static_assert(MigrationStep > 0, "MigrationStep must be positive");
+
+ private:
+  using allocator_traits = std::allocator_traits<Allocator>;
+
+  template <bool IsConst>
+  class common_iterator {
+   public:
+    using difference_type = ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T *, T *>;
+    using reference = std::conditional_t<IsConst, const T &, T &>;
+    using value_type = T;
+    using iterator_category = std::random_access_iterator_tag;
+    using container_type =
+        std::conditional_t<IsConst, const incremental_vector,
+                           incremental_vector>;
+
+    template <bool IsConstFriend>
+    friend class common_iterator;
+
+    common_iterator(container_type *vec, size_t pos) noexcept;
+    common_iterator() noexcept;
+
+    operator common_iterator<true>() const noexcept;
+
+    reference operator*() const;
+    pointer operator->() const;
+    reference operator[](difference_type n) const;
+
+    common_iterator<IsConst> &operator++();
+    common_iterator<IsConst> &operator--();
+    common_iterator<IsConst> operator++(int);
+    common_iterator<IsConst> operator--(int);
+    common_iterator<IsConst> operator+(difference_type n) const;
+    common_iterator<IsConst> operator-(difference_type n) const;
+    common_iterator<IsConst> &operator+=(difference_type n);
+    common_iterator<IsConst> &operator-=(difference_type n);
+    difference_type operator-(const common_iterator<true> &other) const;
+
+    inline bool operator==(const common_iterator<true> &other) const noexcept;
+    inline bool operator!=(const common_iterator<true> &other) const noexcept;
+    inline bool operator<(const common_iterator<true> &other) const noexcept;
+    inline bool operator>(const common_iterator<true> &other) const noexcept;
+    inline bool operator<=(const common_iterator<true> &other) const noexcept;
+    inline bool operator>=(const common_iterator<true> &other) const noexcept;
+
+   private:
+    container_type *_vec;
+    size_t _pos;
+  };
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = typename allocator_traits::pointer;
+  using const_pointer = typename allocator_traits::const_pointer;
+  using iterator = common_iterator<false>;
+  using const_iterator = common_iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  incremental_vector() noexcept(noexcept(Allocator()));
+  explicit incremental_vector(const Allocator &alloc) noexcept;
+  incremental_vector(std::initializer_list<T> init,
+                     const Allocator &alloc = Allocator());
+  incremental_vector(const incremental_vector &other);
+  incremental_vector(incremental_vector &&other) noexcept;
+  ~incremental_vector();
+  incremental_vector &operator=(incremental_vector other) noexcept(
+      allocator_traits::propagate_on_container_swap::value ||
+      allocator_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const noexcept;
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+  reverse_iterator rbegin() noexcept;
+  const_reverse_iterator rbegin() const noexcept;
+  const_reverse_iterator crbegin() const noexcept;
+  reverse_iterator rend() noexcept;
+  const_reverse_iterator rend() const noexcept;
+  const_reverse_iterator crend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept;
+  bool migrating() const noexcept;
+  void finish_migration();
+
+  void clear() noexcept;
+  void push_back(const T &value);
+  void push_back(T &&value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void swap(incremental_vector &other) noexcept(
+      allocator_traits::propagate_on_container_swap::value ||
+      allocator_traits::is_always_equal::value);
+
+ private:
+  T *slot(size_type pos) const noexcept;
+  template <class... Args>
+  void grow(Args &&...args);
+  void migrate(size_type count);
+  void release_old() noexcept;
+
+  size_type _size;
+  size_type _capacity;
+  pointer _arr;
+  // Elements [_moved, _old_end) still live in _old_arr at their own index.
+  pointer _old_arr;
+  size_type _old_capacity;
+  size_type _moved;
+  size_type _old_end;
+  size_type _step;
+  Allocator _allocator;
+};
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+incremental_vector<T, Allocator, GrowthPolicy,
+                   MigrationStep>::incremental_vector() noexcept(
+    noexcept(Allocator()))
+    : incremental_vector(Allocator()) {}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    incremental_vector(const Allocator &alloc) noexcept
+    : _size(0),
+      _capacity(0),
+      _arr(nullptr),
+      _old_arr(nullptr),
+      _old_capacity(0),
+      _moved(0),
+      _old_end(0),
+      _step(MigrationStep),
+      _allocator(alloc) {}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    incremental_vector(std::initializer_list<T> init, const Allocator &alloc)
+    : incremental_vector(alloc) {
+  reserve(init.size());
+  for (const T &value : init) push_back(value);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    incremental_vector(const incremental_vector &other)
+    : incremental_vector(
+          allocator_traits::select_on_container_copy_construction(
+              other._allocator)) {
+  reserve(other._size);
+  for (const T &value : other) push_back(value);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    incremental_vector(incremental_vector &&other) noexcept
+    : _size(other._size),
+      _capacity(other._capacity),
+      _arr(other._arr),
+      _old_arr(other._old_arr),
+      _old_capacity(other._old_capacity),
+      _moved(other._moved),
+      _old_end(other._old_end),
+      _step(other._step),
+      _allocator(std::move(other._allocator)) {
+  other._size = other._capacity = other._old_capacity = 0;
+  other._moved = other._old_end = 0;
+  other._arr = other._old_arr = nullptr;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+incremental_vector<T, Allocator, GrowthPolicy,
+                   MigrationStep>::~incremental_vector() {
+  clear();
+  if (_arr != nullptr)
+    allocator_traits::deallocate(_allocator, _arr, _capacity);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep> &
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::operator=(
+    incremental_vector other) noexcept(
+    allocator_traits::propagate_on_container_swap::value ||
+    allocator_traits::is_always_equal::value) {
+  swap(other);
+  return *this;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::allocator_type
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::get_allocator()
+    const noexcept {
+  return _allocator;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::at(
+    size_type pos) {
+  if (pos >= _size) throw std::out_of_range("Index out of range");
+  return *slot(pos);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::at(
+    size_type pos) const {
+  if (pos >= _size) throw std::out_of_range("Index out of range");
+  return *slot(pos);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::operator[](
+    size_type pos) {
+  return *slot(pos);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::operator[](
+    size_type pos) const {
+  return *slot(pos);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::front() {
+  return *slot(0);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::front() const {
+  return *slot(0);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::back() {
+  return *slot(_size - 1);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::back() const {
+  return *slot(_size - 1);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::iterator
+incremental_vector<T, Allocator, GrowthPolicy,
+                   MigrationStep>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::begin()
+    const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::cbegin()
+    const noexcept {
+  return begin();
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::end() noexcept {
+  return iterator(this, _size);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::end()
+    const noexcept {
+  return const_iterator(this, _size);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::cend()
+    const noexcept {
+  return end();
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::reverse_iterator
+incremental_vector<T, Allocator, GrowthPolicy,
+                   MigrationStep>::rbegin() noexcept {
+  return reverse_iterator(end());
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_reverse_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::rbegin()
+    const noexcept {
+  return const_reverse_iterator(end());
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_reverse_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::crbegin()
+    const noexcept {
+  return rbegin();
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::reverse_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::rend() noexcept {
+  return reverse_iterator(begin());
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_reverse_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::rend()
+    const noexcept {
+  return const_reverse_iterator(begin());
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::const_reverse_iterator
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::crend()
+    const noexcept {
+  return rend();
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+bool incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::empty()
+    const noexcept {
+  return _size == 0;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::size_type
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::size()
+    const noexcept {
+  return _size;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::size_type
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::max_size()
+    const noexcept {
+  return allocator_traits::max_size(_allocator);
+}
+
+// An explicit reserve is allowed to pay for a full move, so it finishes any
+// pending migration and then reallocates in one go.
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::reserve(
+    size_type new_cap) {
+  if (new_cap > max_size()) throw std::length_error("Too large size");
+  if (new_cap <= _capacity) return;
+  finish_migration();
+  pointer new_arr = allocator_traits::allocate(_allocator, new_cap);
+  _old_arr = _arr;
+  _old_capacity = _capacity;
+  _moved = 0;
+  _old_end = _size;
+  _arr = new_arr;
+  _capacity = new_cap;
+  finish_migration();
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::size_type
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::capacity()
+    const noexcept {
+  return _capacity;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+bool incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::migrating()
+    const noexcept {
+  return _old_arr != nullptr;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy,
+                        MigrationStep>::finish_migration() {
+  if (_old_arr != nullptr) migrate(_old_end - _moved);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy,
+                        MigrationStep>::clear() noexcept {
+  while (_size > 0) pop_back();
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::push_back(
+    const T &value) {
+  emplace_back(value);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::push_back(
+    T &&value) {
+  emplace_back(std::move(value));
+}
+
+// The new element is constructed before anything is migrated, so arguments
+// that refer into the vector stay valid. If a migration step throws, the
+// element has still been added and the vector stays consistent.
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <class... Args>
+typename incremental_vector<T, Allocator, GrowthPolicy,
+                            MigrationStep>::reference
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::emplace_back(
+    Args &&...args) {
+  if (_size == _capacity) {
+    grow(std::forward<Args>(args)...);
+  } else {
+    allocator_traits::construct(_allocator, _arr + _size,
+                                std::forward<Args>(args)...);
+    ++_size;
+    if (_old_arr != nullptr) migrate(std::min(_step, _old_end - _moved));
+  }
+  return _arr[_size - 1];
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy,
+                        MigrationStep>::pop_back() {
+  --_size;
+  allocator_traits::destroy(_allocator, slot(_size));
+  if (_old_end > _size) {
+    _old_end = _size;
+    if (_moved >= _old_end) release_old();
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::swap(
+    incremental_vector &other) noexcept(
+    allocator_traits::propagate_on_container_swap::value ||
+    allocator_traits::is_always_equal::value) {
+  std::swap(_size, other._size);
+  std::swap(_capacity, other._capacity);
+  std::swap(_arr, other._arr);
+  std::swap(_old_arr, other._old_arr);
+  std::swap(_old_capacity, other._old_capacity);
+  std::swap(_moved, other._moved);
+  std::swap(_old_end, other._old_end);
+  std::swap(_step, other._step);
+  if constexpr (allocator_traits::propagate_on_container_swap::value)
+    std::swap(_allocator, other._allocator);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+T *incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::slot(
+    size_type pos) const noexcept {
+  return pos >= _moved && pos < _old_end ? _old_arr + pos : _arr + pos;
+}
+
+// The step is chosen so that the old buffer is empty by the time the new
+// one is full: with doubling that is MigrationStep, with slower growth it
+// is ceil(old size / free slots).
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <class... Args>
+void incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::grow(
+    Args &&...args) {
+  if (_size == max_size()) throw std::length_error("Too large size");
+  finish_migration();
+  size_type new_cap =
+      GrowthPolicy::template next_capacity<T>(_capacity, _size + 1);
+  new_cap = std::min(std::max(new_cap, _size + 1), max_size());
+  pointer new_arr = allocator_traits::allocate(_allocator, new_cap);
+  try {
+    allocator_traits::construct(_allocator, new_arr + _size,
+                                std::forward<Args>(args)...);
+  } catch (...) {
+    allocator_traits::deallocate(_allocator, new_arr, new_cap);
+    throw;
+  }
+  _old_arr = _arr;
+  _old_capacity = _capacity;
+  _moved = 0;
+  _old_end = _size;
+  _arr = new_arr;
+  _capacity = new_cap;
+  ++_size;
+  size_type free_slots = _capacity - _size;
+  _step = free_slots == 0 ? _old_end
+                          : std::max(MigrationStep,
+                                     (_old_end + free_slots - 1) / free_slots);
+  if (_old_end == 0) release_old();
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::migrate(
+    size_type count) {
+  if constexpr (is_trivially_relocatable_v<T>) {
+    uninitialized_relocate_n(_old_arr + _moved, count, _arr + _moved);
+    _moved += count;
+  } else {
+    for (size_type end = _moved + count; _moved < end; ++_moved) {
+      allocator_traits::construct(_allocator, _arr + _moved,
+                                  std::move_if_noexcept(_old_arr[_moved]));
+      allocator_traits::destroy(_allocator, _old_arr + _moved);
+    }
+  }
+  if (_moved == _old_end) release_old();
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+void incremental_vector<T, Allocator, GrowthPolicy,
+                        MigrationStep>::release_old() noexcept {
+  if (_old_arr != nullptr)
+    allocator_traits::deallocate(_allocator, _old_arr, _old_capacity);
+  _old_arr = nullptr;
+  _old_capacity = 0;
+  _moved = 0;
+  _old_end = 0;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::common_iterator<
+    IsConst>::common_iterator(container_type *vec, size_t pos) noexcept
+    : _vec(vec), _pos(pos) {}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::common_iterator<
+    IsConst>::common_iterator() noexcept
+    : _vec(nullptr), _pos(0) {}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::common_iterator<
+    IsConst>::operator common_iterator<true>() const noexcept {
+  return common_iterator<true>(_vec, _pos);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst>::reference
+    incremental_vector<T, Allocator, GrowthPolicy,
+                       MigrationStep>::common_iterator<IsConst>::operator*()
+        const {
+  return (*_vec)[_pos];
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst>::pointer
+    incremental_vector<T, Allocator, GrowthPolicy,
+                       MigrationStep>::common_iterator<IsConst>::operator->()
+        const {
+  return &(*_vec)[_pos];
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst>::reference
+    incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+        common_iterator<IsConst>::operator[](difference_type n) const {
+  return (*_vec)[_pos + n];
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst> &
+    incremental_vector<T, Allocator, GrowthPolicy,
+                       MigrationStep>::common_iterator<IsConst>::operator++() {
+  ++_pos;
+  return *this;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst> &
+    incremental_vector<T, Allocator, GrowthPolicy,
+                       MigrationStep>::common_iterator<IsConst>::operator--() {
+  --_pos;
+  return *this;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst>
+    incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+        common_iterator<IsConst>::operator++(int) {
+  common_iterator result = *this;
+  ++_pos;
+  return result;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst>
+    incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+        common_iterator<IsConst>::operator--(int) {
+  common_iterator result = *this;
+  --_pos;
+  return result;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst>
+    incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+        common_iterator<IsConst>::operator+(difference_type n) const {
+  return common_iterator(_vec, _pos + n);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst>
+    incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+        common_iterator<IsConst>::operator-(difference_type n) const {
+  return common_iterator(_vec, _pos - n);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst> &
+    incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+        common_iterator<IsConst>::operator+=(difference_type n) {
+  _pos += n;
+  return *this;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst> &
+    incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+        common_iterator<IsConst>::operator-=(difference_type n) {
+  _pos -= n;
+  return *this;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+typename incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    template common_iterator<IsConst>::difference_type
+    incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+        common_iterator<IsConst>::operator-(
+            const common_iterator<true> &other) const {
+  return static_cast<difference_type>(_pos) -
+         static_cast<difference_type>(other._pos);
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+inline bool incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    common_iterator<IsConst>::operator==(
+        const common_iterator<true> &other) const noexcept {
+  return _pos == other._pos;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+inline bool incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    common_iterator<IsConst>::operator!=(
+        const common_iterator<true> &other) const noexcept {
+  return _pos != other._pos;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+inline bool incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    common_iterator<IsConst>::operator<(
+        const common_iterator<true> &other) const noexcept {
+  return _pos < other._pos;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+inline bool incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    common_iterator<IsConst>::operator>(
+        const common_iterator<true> &other) const noexcept {
+  return _pos > other._pos;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+inline bool incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    common_iterator<IsConst>::operator<=(
+        const common_iterator<true> &other) const noexcept {
+  return _pos <= other._pos;
+}
+
+template <class T, class Allocator, class GrowthPolicy,
+          std::size_t MigrationStep>
+template <bool IsConst>
+inline bool incremental_vector<T, Allocator, GrowthPolicy, MigrationStep>::
+    common_iterator<IsConst>::operator>=(
+        const common_iterator<true> &other) const noexcept {
+  return _pos >= other._pos;
+}
+
+}  // namespace s21
+
+#endif  // S21_INCREMENTAL_VECTOR_H_
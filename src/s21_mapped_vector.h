@@ -0,0 +1,586 @@
+#ifndef S21_MAPPED_VECTOR_H_
+#define S21_MAPPED_VECTOR_H_
+
+#include <cerrno>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "s21_growth_policy.h"
+
+namespace s21 {
+
+enum class map_mode {
+  read_only,  // private copy-on-write mapping, the file is never written
+  read_write  // shared mapping, growth extends the file
+};
+
+enum class access_advice { normal, sequential, random, willneed, dontneed };
+
+// Vector of trivially copyable records stored in a memory-mapped file.
+// Opening a file maps it as is, so startup costs one mmap call however large
+// the file is, and pages are read on first touch. In read_write mode the
+// vector grows by extending the file with ftruncate and remapping; close()
+// trims the file to size() records. The records follow a file_header_size
+// byte header that holds the record size and the element count. Every size
+// change stores the count there through the mapping, so if the process dies
+// before close() the zero-filled spare capacity is not read back as records.
+// Supported on Linux only.
+template <class T, class GrowthPolicy = capped_growth<>>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mapped_vector stores raw bytes of trivially copyable types");
+  static_assert(alignof(T) <= 64, "Alignment too large");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr size_type file_header_size = 64;
+
+  mapped_vector() noexcept;
+  explicit mapped_vector(const std::string &path,
+                         map_mode mode = map_mode::read_only);
+  mapped_vector(const mapped_vector &) = delete;
+  mapped_vector(mapped_vector &&other) noexcept;
+  ~mapped_vector();
+  mapped_vector &operator=(const mapped_vector &) = delete;
+  mapped_vector &operator=(mapped_vector &&other) noexcept;
+
+  void open(const std::string &path, map_mode mode = map_mode::read_only);
+  void close();
+  bool is_open() const noexcept;
+  map_mode mode() const noexcept;
+  void advise(access_advice advice) const;
+  void sync() const;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  T *data() noexcept;
+  const T *data() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+  reverse_iterator rbegin() noexcept;
+  const_reverse_iterator rbegin() const noexcept;
+  const_reverse_iterator crbegin() const noexcept;
+  reverse_iterator rend() noexcept;
+  const_reverse_iterator rend() const noexcept;
+  const_reverse_iterator crend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+
+  void clear();
+  void push_back(const T &value);
+  template <class... Args>
+  void emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type count);
+  void resize(size_type count, const value_type &value);
+  void swap(mapped_vector &other) noexcept;
+
+ private:
+  struct file_header {
+    std::uint64_t magic;
+    std::uint64_t record_size;
+    std::uint64_t size;
+  };
+
+  // "S21MAPV1" in file byte order.
+  static constexpr std::uint64_t file_magic = 0x315650414d313253;
+
+  file_header *header() const noexcept;
+  void set_size(size_type count) noexcept;
+  void check_writable() const;
+  void remap(size_type new_cap);
+  void unmap() noexcept;
+  [[noreturn]] static void throw_system_error(const char *what);
+
+  size_type _size;
+  size_type _capacity;
+  unsigned char *_map;
+  T *_arr;
+  int _fd;
+  map_mode _mode;
+};
+
+template <class T, class GrowthPolicy>
+mapped_vector<T, GrowthPolicy>::mapped_vector() noexcept
+    : _size(0),
+      _capacity(0),
+      _map(nullptr),
+      _arr(nullptr),
+      _fd(-1),
+      _mode(map_mode::read_only) {}
+
+template <class T, class GrowthPolicy>
+mapped_vector<T, GrowthPolicy>::mapped_vector(const std::string &path,
+                                              map_mode mode)
+    : mapped_vector() {
+  open(path, mode);
+}
+
+template <class T, class GrowthPolicy>
+mapped_vector<T, GrowthPolicy>::mapped_vector(mapped_vector &&other) noexcept
+    : _size(other._size),
+      _capacity(other._capacity),
+      _map(other._map),
+      _arr(other._arr),
+      _fd(other._fd),
+      _mode(other._mode) {
+  other._size = 0;
+  other._capacity = 0;
+  other._map = nullptr;
+  other._arr = nullptr;
+  other._fd = -1;
+}
+
+template <class T, class GrowthPolicy>
+mapped_vector<T, GrowthPolicy>::~mapped_vector() {
+  try {
+    close();
+  } catch (...) {
+    unmap();
+#if defined(__linux__)
+    ::close(_fd);
+#endif
+  }
+}
+
+template <class T, class GrowthPolicy>
+mapped_vector<T, GrowthPolicy> &mapped_vector<T, GrowthPolicy>::operator=(
+    mapped_vector &&other) noexcept {
+  if (this != &other) {
+    mapped_vector(std::move(other)).swap(*this);
+  }
+  return *this;
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::open(const std::string &path,
+                                          map_mode mode) {
+  close();
+#if defined(__linux__)
+  int flags = mode == map_mode::read_write ? O_RDWR | O_CREAT : O_RDONLY;
+  int fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+  if (fd == -1) throw_system_error("open");
+  struct stat info;
+  if (fstat(fd, &info) == -1) {
+    int error = errno;
+    ::close(fd);
+    errno = error;
+    throw_system_error("fstat");
+  }
+  size_type bytes = static_cast<size_type>(info.st_size);
+  bool fresh = bytes == 0 && mode == map_mode::read_write;
+  if (!fresh && (bytes < file_header_size ||
+                 (bytes - file_header_size) % sizeof(T) != 0)) {
+    ::close(fd);
+    throw std::runtime_error("mapped_vector: file size does not match a "
+                             "header and whole records");
+  }
+  _fd = fd;
+  _mode = mode;
+  try {
+    remap(fresh ? 0 : (bytes - file_header_size) / sizeof(T));
+    file_header *file = header();
+    if (fresh) {
+      file->magic = file_magic;
+      file->record_size = sizeof(T);
+      file->size = 0;
+    } else if (file->magic != file_magic || file->record_size != sizeof(T) ||
+               file->size > _capacity) {
+      throw std::runtime_error("mapped_vector: bad file header");
+    }
+    _size = static_cast<size_type>(file->size);
+  } catch (...) {
+    unmap();
+    ::close(_fd);
+    _fd = -1;
+    throw;
+  }
+#else
+  (void)path;
+  (void)mode;
+  throw std::runtime_error("mapped_vector is not supported on this platform");
+#endif
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::close() {
+#if defined(__linux__)
+  if (_fd == -1) return;
+  if (_mode == map_mode::read_write && _capacity != _size) shrink_to_fit();
+  unmap();
+  ::close(_fd);
+  _fd = -1;
+  _size = 0;
+#endif
+}
+
+template <class T, class GrowthPolicy>
+bool mapped_vector<T, GrowthPolicy>::is_open() const noexcept {
+  return _fd != -1;
+}
+
+template <class T, class GrowthPolicy>
+map_mode mapped_vector<T, GrowthPolicy>::mode() const noexcept {
+  return _mode;
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::advise(access_advice advice) const {
+#if defined(__linux__)
+  if (_map == nullptr) return;
+  static const int advice_flags[] = {MADV_NORMAL, MADV_SEQUENTIAL,
+                                     MADV_RANDOM, MADV_WILLNEED,
+                                     MADV_DONTNEED};
+  if (madvise(_map, file_header_size + _capacity * sizeof(T),
+              advice_flags[static_cast<int>(advice)]) == -1)
+    throw_system_error("madvise");
+#else
+  (void)advice;
+#endif
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::sync() const {
+#if defined(__linux__)
+  if (_map == nullptr || _mode != map_mode::read_write) return;
+  if (msync(_map, file_header_size + _capacity * sizeof(T), MS_SYNC) == -1)
+    throw_system_error("msync");
+#endif
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::reference
+mapped_vector<T, GrowthPolicy>::at(size_type pos) {
+  if (pos >= _size) throw std::out_of_range("Index out of range");
+  return _arr[pos];
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_reference
+mapped_vector<T, GrowthPolicy>::at(size_type pos) const {
+  if (pos >= _size) throw std::out_of_range("Index out of range");
+  return _arr[pos];
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::reference
+mapped_vector<T, GrowthPolicy>::operator[](size_type pos) {
+  return _arr[pos];
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_reference
+mapped_vector<T, GrowthPolicy>::operator[](size_type pos) const {
+  return _arr[pos];
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::reference
+mapped_vector<T, GrowthPolicy>::front() {
+  return _arr[0];
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_reference
+mapped_vector<T, GrowthPolicy>::front() const {
+  return _arr[0];
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::reference
+mapped_vector<T, GrowthPolicy>::back() {
+  return _arr[_size - 1];
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_reference
+mapped_vector<T, GrowthPolicy>::back() const {
+  return _arr[_size - 1];
+}
+
+template <class T, class GrowthPolicy>
+T *mapped_vector<T, GrowthPolicy>::data() noexcept {
+  return _arr;
+}
+
+template <class T, class GrowthPolicy>
+const T *mapped_vector<T, GrowthPolicy>::data() const noexcept {
+  return _arr;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::iterator
+mapped_vector<T, GrowthPolicy>::begin() noexcept {
+  return _arr;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_iterator
+mapped_vector<T, GrowthPolicy>::begin() const noexcept {
+  return _arr;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_iterator
+mapped_vector<T, GrowthPolicy>::cbegin() const noexcept {
+  return _arr;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::iterator
+mapped_vector<T, GrowthPolicy>::end() noexcept {
+  return _arr + _size;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_iterator
+mapped_vector<T, GrowthPolicy>::end() const noexcept {
+  return _arr + _size;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_iterator
+mapped_vector<T, GrowthPolicy>::cend() const noexcept {
+  return _arr + _size;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::reverse_iterator
+mapped_vector<T, GrowthPolicy>::rbegin() noexcept {
+  return reverse_iterator(end());
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_reverse_iterator
+mapped_vector<T, GrowthPolicy>::rbegin() const noexcept {
+  return const_reverse_iterator(cend());
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_reverse_iterator
+mapped_vector<T, GrowthPolicy>::crbegin() const noexcept {
+  return const_reverse_iterator(cend());
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::reverse_iterator
+mapped_vector<T, GrowthPolicy>::rend() noexcept {
+  return reverse_iterator(begin());
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_reverse_iterator
+mapped_vector<T, GrowthPolicy>::rend() const noexcept {
+  return const_reverse_iterator(cbegin());
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::const_reverse_iterator
+mapped_vector<T, GrowthPolicy>::crend() const noexcept {
+  return const_reverse_iterator(cbegin());
+}
+
+template <class T, class GrowthPolicy>
+bool mapped_vector<T, GrowthPolicy>::empty() const noexcept {
+  return _size == 0;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::size_type
+mapped_vector<T, GrowthPolicy>::size() const noexcept {
+  return _size;
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::size_type
+mapped_vector<T, GrowthPolicy>::max_size() const noexcept {
+  return (PTRDIFF_MAX - file_header_size) / sizeof(T);
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::reserve(size_type new_cap) {
+  check_writable();
+  if (new_cap > max_size()) throw std::length_error("Too large size");
+  if (new_cap > _capacity) remap(new_cap);
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::size_type
+mapped_vector<T, GrowthPolicy>::capacity() const noexcept {
+  return _capacity;
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::shrink_to_fit() {
+  check_writable();
+  if (_size != _capacity) remap(_size);
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::clear() {
+  check_writable();
+  set_size(0);
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::push_back(const T &value) {
+  emplace_back(value);
+}
+
+template <class T, class GrowthPolicy>
+template <class... Args>
+void mapped_vector<T, GrowthPolicy>::emplace_back(Args &&...args) {
+  check_writable();
+  T value(std::forward<Args>(args)...);
+  if (_size == _capacity)
+    remap(GrowthPolicy::template next_capacity<T>(_capacity, _size + 1));
+  ::new (static_cast<void *>(_arr + _size)) T(value);
+  set_size(_size + 1);
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::pop_back() {
+  check_writable();
+  set_size(_size - 1);
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::resize(size_type count) {
+  resize(count, T());
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::resize(size_type count,
+                                            const value_type &value) {
+  check_writable();
+  if (count > _capacity) {
+    T copy = value;
+    reserve(count);
+    std::uninitialized_fill(_arr + _size, _arr + count, copy);
+  } else if (count > _size) {
+    std::uninitialized_fill(_arr + _size, _arr + count, value);
+  }
+  set_size(count);
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::swap(mapped_vector &other) noexcept {
+  std::swap(_size, other._size);
+  std::swap(_capacity, other._capacity);
+  std::swap(_map, other._map);
+  std::swap(_arr, other._arr);
+  std::swap(_fd, other._fd);
+  std::swap(_mode, other._mode);
+}
+
+template <class T, class GrowthPolicy>
+typename mapped_vector<T, GrowthPolicy>::file_header *
+mapped_vector<T, GrowthPolicy>::header() const noexcept {
+  return reinterpret_cast<file_header *>(_map);
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::set_size(size_type count) noexcept {
+  _size = count;
+  header()->size = count;
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::check_writable() const {
+  if (_fd == -1 || _mode != map_mode::read_write)
+    throw std::logic_error("mapped_vector is not open for writing");
+}
+
+// Resizes the file in read_write mode and maps its header and new_cap
+// records. The old mapping stays valid until the new one succeeds; on Linux
+// mremap moves the page tables instead of copying anything.
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::remap(size_type new_cap) {
+#if defined(__linux__)
+  size_type bytes = file_header_size + new_cap * sizeof(T);
+  size_type old_bytes = file_header_size + _capacity * sizeof(T);
+  if (_mode == map_mode::read_write &&
+      ftruncate(_fd, static_cast<off_t>(bytes)) == -1)
+    throw_system_error("ftruncate");
+  void *result = MAP_FAILED;
+  if (_map != nullptr) {
+    result = mremap(_map, old_bytes, bytes, MREMAP_MAYMOVE);
+  } else {
+    int protection = PROT_READ | PROT_WRITE;
+    int flags = _mode == map_mode::read_write ? MAP_SHARED : MAP_PRIVATE;
+    result = mmap(nullptr, bytes, protection, flags, _fd, 0);
+  }
+  if (result == MAP_FAILED) {
+    int error = errno;
+    if (_mode == map_mode::read_write && _map != nullptr)
+      (void)!ftruncate(_fd, static_cast<off_t>(old_bytes));
+    errno = error;
+    throw_system_error("mmap");
+  }
+  _map = static_cast<unsigned char *>(result);
+  _arr = new_cap ? reinterpret_cast<T *>(_map + file_header_size) : nullptr;
+  _capacity = new_cap;
+#else
+  (void)new_cap;
+#endif
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::unmap() noexcept {
+#if defined(__linux__)
+  if (_map != nullptr) munmap(_map, file_header_size + _capacity * sizeof(T));
+#endif
+  _map = nullptr;
+  _arr = nullptr;
+  _capacity = 0;
+}
+
+template <class T, class GrowthPolicy>
+void mapped_vector<T, GrowthPolicy>::throw_system_error(const char *what) {
+  throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace s21
+
+#endif  // S21_MAPPED_VECTOR_H_
@@ -0,0 +1,124 @@
+#ifndef S21_MEMORY_H_
+#define S21_MEMORY_H_
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace s21 {
+
+// A type is trivially relocatable if moving an object to a new address and
+// ending the lifetime of the old one is equivalent to copying its bytes.
+// Every trivially copyable type qualifies. Other types (handles, smart
+// pointers) may opt in by specializing this trait.
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <class T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+// Pointers and iterators that declare a nested is_contiguous type address
+// elements stored back to back, so ranges of them can be copied in bulk.
+template <class It, class = void>
+struct is_contiguous_iterator : std::is_pointer<It> {};
+
+template <class It>
+struct is_contiguous_iterator<It, std::void_t<typename It::is_contiguous>>
+    : It::is_contiguous {};
+
+template <class It>
+inline constexpr bool is_contiguous_iterator_v =
+    is_contiguous_iterator<It>::value;
+
+// Optional allocator extensions for resizing a block without a separate
+// allocate-copy-deallocate round trip:
+//   pointer reallocate(pointer p, size_type old_n, size_type new_n) returns
+//     a block of new_n elements holding the bytes of the first
+//     min(old_n, new_n) elements of p, possibly at a new address. It throws
+//     and leaves p untouched on failure.
+//   bool try_expand(pointer p, size_type old_n, size_type new_n) resizes
+//     the block in place and reports whether it succeeded.
+template <class Alloc, class = void>
+struct allocator_has_reallocate : std::false_type {};
+
+template <class Alloc>
+struct allocator_has_reallocate<
+    Alloc, std::void_t<decltype(std::declval<Alloc &>().reallocate(
+               std::declval<typename std::allocator_traits<Alloc>::pointer>(),
+               std::size_t(), std::size_t()))>> : std::true_type {};
+
+template <class Alloc>
+inline constexpr bool allocator_has_reallocate_v =
+    allocator_has_reallocate<Alloc>::value;
+
+template <class Alloc, class = void>
+struct allocator_has_try_expand : std::false_type {};
+
+template <class Alloc>
+struct allocator_has_try_expand<
+    Alloc, std::void_t<decltype(std::declval<Alloc &>().try_expand(
+               std::declval<typename std::allocator_traits<Alloc>::pointer>(),
+               std::size_t(), std::size_t()))>> : std::true_type {};
+
+template <class Alloc>
+inline constexpr bool allocator_has_try_expand_v =
+    allocator_has_try_expand<Alloc>::value;
+
+// Alignment that allocate() of Alloc guarantees: Alloc::alignment when the
+// allocator declares one, alignof(value_type) otherwise.
+template <class Alloc, class = void>
+struct allocator_alignment
+    : std::integral_constant<
+          std::size_t,
+          alignof(typename std::allocator_traits<Alloc>::value_type)> {};
+
+template <class Alloc>
+struct allocator_alignment<Alloc, std::void_t<decltype(Alloc::alignment)>>
+    : std::integral_constant<std::size_t, Alloc::alignment> {};
+
+template <class Alloc>
+inline constexpr std::size_t allocator_alignment_v =
+    allocator_alignment<Alloc>::value;
+
+// Tells the compiler that p is aligned to Align bytes, so loops over the
+// memory it points to can use aligned vector loads without a peeled prologue.
+template <std::size_t Align, class T>
+constexpr T *assume_aligned(T *p) noexcept {
+  static_assert(Align != 0 && (Align & (Align - 1)) == 0,
+                "alignment must be a power of two");
+#if defined(__GNUC__)
+  if (__builtin_is_constant_evaluated()) return p;
+  return static_cast<T *>(__builtin_assume_aligned(p, Align));
+#else
+  return p;
+#endif
+}
+
+// Tag for constructors and resize overloads that default-initialize new
+// elements. Trivially default constructible elements are then left with
+// indeterminate values, which saves zeroing buffers that are about to be
+// overwritten anyway.
+struct default_init_t {
+  explicit default_init_t() = default;
+};
+
+inline constexpr default_init_t default_init{};
+
+// Relocates count objects from first to the uninitialized storage at dest.
+// The source objects must not be destroyed afterwards.
+template <class T>
+void uninitialized_relocate_n(T *first, std::size_t count, T *dest) noexcept {
+  static_assert(is_trivially_relocatable_v<T>,
+                "uninitialized_relocate_n requires a trivially relocatable T");
+  if (count != 0)
+    std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first),
+                count * sizeof(T));
+}
+
+}  // namespace s21
+
+#endif  // S21_MEMORY_H_
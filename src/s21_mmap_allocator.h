@@ -0,0 +1,165 @@
+#ifndef S21_MMAP_ALLOCATOR_H_
+#define S21_MMAP_ALLOCATOR_H_
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+
+enum class huge_pages {
+  none,         // plain 4K pages
+  transparent,  // 2M-aligned mappings advised with MADV_HUGEPAGE
+  hugetlb       // MAP_HUGETLB, falling back to transparent if none reserved
+};
+
+// Allocator for large, long-lived buffers. Requests of at least MapThreshold
+// bytes are served by anonymous mmap backed by huge pages where possible,
+// which cuts TLB misses on repeated scans; smaller requests go to
+// operator new. Outside Linux every request goes to operator new.
+template <class T, huge_pages HugePages = huge_pages::transparent,
+          std::size_t MapThreshold = 2 << 20>
+class mmap_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  static constexpr size_type huge_page_size = 2 << 20;
+
+  template <class U>
+  struct rebind {
+    using other = mmap_allocator<U, HugePages, MapThreshold>;
+  };
+
+  mmap_allocator() noexcept = default;
+  template <class U>
+  mmap_allocator(
+      const mmap_allocator<U, HugePages, MapThreshold> &other) noexcept;
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n) noexcept;
+  size_type max_size() const noexcept;
+
+  bool operator==(const mmap_allocator &other) const noexcept;
+  bool operator!=(const mmap_allocator &other) const noexcept;
+
+ private:
+  static bool is_mapped(size_type n) noexcept;
+  static size_type mapped_bytes(size_type n) noexcept;
+  static void *map_aligned(size_type bytes) noexcept;
+};
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+template <class U>
+mmap_allocator<T, HugePages, MapThreshold>::mmap_allocator(
+    const mmap_allocator<U, HugePages, MapThreshold> &) noexcept {}
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+T *mmap_allocator<T, HugePages, MapThreshold>::allocate(size_type n) {
+  if (n > max_size()) throw std::bad_array_new_length();
+#if defined(__linux__)
+  if (is_mapped(n)) {
+    size_type bytes = mapped_bytes(n);
+    void *result = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    if (HugePages == huge_pages::hugetlb)
+      result = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    if (result == MAP_FAILED) result = map_aligned(bytes);
+    if (result == MAP_FAILED) throw std::bad_alloc();
+#if defined(MADV_HUGEPAGE)
+    if (HugePages != huge_pages::none) madvise(result, bytes, MADV_HUGEPAGE);
+#endif
+    return static_cast<T *>(result);
+  }
+#endif
+  return std::allocator<T>().allocate(n);
+}
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+void mmap_allocator<T, HugePages, MapThreshold>::deallocate(
+    T *p, size_type n) noexcept {
+#if defined(__linux__)
+  if (is_mapped(n)) {
+    munmap(p, mapped_bytes(n));
+    return;
+  }
+#endif
+  std::allocator<T>().deallocate(p, n);
+}
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+typename mmap_allocator<T, HugePages, MapThreshold>::size_type
+mmap_allocator<T, HugePages, MapThreshold>::max_size() const noexcept {
+  return PTRDIFF_MAX / sizeof(T);
+}
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+bool mmap_allocator<T, HugePages, MapThreshold>::operator==(
+    const mmap_allocator &) const noexcept {
+  return true;
+}
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+bool mmap_allocator<T, HugePages, MapThreshold>::operator!=(
+    const mmap_allocator &) const noexcept {
+  return false;
+}
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+bool mmap_allocator<T, HugePages, MapThreshold>::is_mapped(
+    size_type n) noexcept {
+  return n * sizeof(T) >= MapThreshold;
+}
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+typename mmap_allocator<T, HugePages, MapThreshold>::size_type
+mmap_allocator<T, HugePages, MapThreshold>::mapped_bytes(
+    size_type n) noexcept {
+#if defined(__linux__)
+  static const size_type page_size = sysconf(_SC_PAGESIZE);
+#else
+  const size_type page_size = 4096;
+#endif
+  size_type granularity =
+      HugePages == huge_pages::none ? page_size : huge_page_size;
+  return (n * sizeof(T) + granularity - 1) / granularity * granularity;
+}
+
+template <class T, huge_pages HugePages, std::size_t MapThreshold>
+void *mmap_allocator<T, HugePages, MapThreshold>::map_aligned(
+    size_type bytes) noexcept {
+#if defined(__linux__)
+  if (HugePages == huge_pages::none)
+    return mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  void *raw = mmap(nullptr, bytes + huge_page_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (raw == MAP_FAILED) return raw;
+  std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(raw);
+  std::uintptr_t aligned =
+      (begin + huge_page_size - 1) / huge_page_size * huge_page_size;
+  if (aligned != begin) munmap(raw, aligned - begin);
+  std::uintptr_t tail = aligned + bytes;
+  std::uintptr_t end = begin + bytes + huge_page_size;
+  if (end != tail) munmap(reinterpret_cast<void *>(tail), end - tail);
+  return reinterpret_cast<void *>(aligned);
+#else
+  (void)bytes;
+  return nullptr;
+#endif
+}
+
+}  // namespace s21
+
+#endif  // S21_MMAP_ALLOCATOR_H_
@@ -0,0 +1,170 @@
+#ifndef S21_REALLOC_ALLOCATOR_H_
+#define S21_REALLOC_ALLOCATOR_H_
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+#if defined(__linux__)
+#include <malloc.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+
+// Allocator that supports the reallocate/try_expand extensions. Blocks of at
+// least MapThreshold bytes come from anonymous mappings on Linux and are
+// grown with mremap, which moves page table entries instead of copying data;
+// smaller blocks use malloc/realloc.
+template <class T, std::size_t MapThreshold = 1 << 20>
+class realloc_allocator {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "realloc_allocator does not support over-aligned types");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <class U>
+  struct rebind {
+    using other = realloc_allocator<U, MapThreshold>;
+  };
+
+  realloc_allocator() noexcept = default;
+  template <class U>
+  realloc_allocator(const realloc_allocator<U, MapThreshold> &other) noexcept;
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n) noexcept;
+  T *reallocate(T *p, size_type old_n, size_type new_n);
+  bool try_expand(T *p, size_type old_n, size_type new_n) noexcept;
+  size_type max_size() const noexcept;
+
+  bool operator==(const realloc_allocator &other) const noexcept;
+  bool operator!=(const realloc_allocator &other) const noexcept;
+
+ private:
+  static bool is_mapped(size_type n) noexcept;
+  static size_type mapped_bytes(size_type n) noexcept;
+};
+
+template <class T, std::size_t MapThreshold>
+template <class U>
+realloc_allocator<T, MapThreshold>::realloc_allocator(
+    const realloc_allocator<U, MapThreshold> &) noexcept {}
+
+template <class T, std::size_t MapThreshold>
+T *realloc_allocator<T, MapThreshold>::allocate(size_type n) {
+  if (n > max_size()) throw std::bad_array_new_length();
+  void *result = nullptr;
+#if defined(__linux__)
+  if (is_mapped(n)) {
+    result = mmap(nullptr, mapped_bytes(n), PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (result == MAP_FAILED) throw std::bad_alloc();
+    return static_cast<T *>(result);
+  }
+#endif
+  result = std::malloc(n * sizeof(T));
+  if (result == nullptr) throw std::bad_alloc();
+  return static_cast<T *>(result);
+}
+
+template <class T, std::size_t MapThreshold>
+void realloc_allocator<T, MapThreshold>::deallocate(T *p,
+                                                    size_type n) noexcept {
+#if defined(__linux__)
+  if (is_mapped(n)) {
+    munmap(p, mapped_bytes(n));
+    return;
+  }
+#endif
+  (void)n;
+  std::free(p);
+}
+
+template <class T, std::size_t MapThreshold>
+T *realloc_allocator<T, MapThreshold>::reallocate(T *p, size_type old_n,
+                                                  size_type new_n) {
+  if (new_n > max_size()) throw std::bad_array_new_length();
+#if defined(__linux__)
+  if (is_mapped(old_n) && is_mapped(new_n)) {
+    void *result =
+        mremap(p, mapped_bytes(old_n), mapped_bytes(new_n), MREMAP_MAYMOVE);
+    if (result == MAP_FAILED) throw std::bad_alloc();
+    return static_cast<T *>(result);
+  }
+  if (is_mapped(old_n) || is_mapped(new_n)) {
+    T *result = allocate(new_n);
+    std::memcpy(static_cast<void *>(result), static_cast<const void *>(p),
+                (old_n < new_n ? old_n : new_n) * sizeof(T));
+    deallocate(p, old_n);
+    return result;
+  }
+#endif
+  void *result = std::realloc(p, new_n * sizeof(T));
+  if (result == nullptr) throw std::bad_alloc();
+  return static_cast<T *>(result);
+}
+
+template <class T, std::size_t MapThreshold>
+bool realloc_allocator<T, MapThreshold>::try_expand(T *p, size_type old_n,
+                                                    size_type new_n) noexcept {
+  if (new_n > max_size()) return false;
+#if defined(__linux__)
+  if (is_mapped(old_n) && is_mapped(new_n)) {
+    if (mapped_bytes(new_n) <= mapped_bytes(old_n)) return true;
+    return mremap(p, mapped_bytes(old_n), mapped_bytes(new_n), 0) !=
+           MAP_FAILED;
+  }
+  if (!is_mapped(old_n) && !is_mapped(new_n))
+    return malloc_usable_size(p) >= new_n * sizeof(T);
+#endif
+  (void)p;
+  (void)old_n;
+  return false;
+}
+
+template <class T, std::size_t MapThreshold>
+typename realloc_allocator<T, MapThreshold>::size_type
+realloc_allocator<T, MapThreshold>::max_size() const noexcept {
+  return PTRDIFF_MAX / sizeof(T);
+}
+
+template <class T, std::size_t MapThreshold>
+bool realloc_allocator<T, MapThreshold>::operator==(
+    const realloc_allocator &) const noexcept {
+  return true;
+}
+
+template <class T, std::size_t MapThreshold>
+bool realloc_allocator<T, MapThreshold>::operator!=(
+    const realloc_allocator &) const noexcept {
+  return false;
+}
+
+template <class T, std::size_t MapThreshold>
+bool realloc_allocator<T, MapThreshold>::is_mapped(size_type n) noexcept {
+  return n * sizeof(T) >= MapThreshold;
+}
+
+template <class T, std::size_t MapThreshold>
+typename realloc_allocator<T, MapThreshold>::size_type
+realloc_allocator<T, MapThreshold>::mapped_bytes(size_type n) noexcept {
+#if defined(__linux__)
+  static const size_type page_size = sysconf(_SC_PAGESIZE);
+#else
+  const size_type page_size = 4096;
+#endif
+  return (n * sizeof(T) + page_size - 1) / page_size * page_size;
+}
+
+}  // namespace s21
+
+#endif  // S21_REALLOC_ALLOCATOR_H_
@@ -0,0 +1,710 @@
+#ifndef S21_SEGMENTED_VECTOR_H_
+#define S21_SEGMENTED_VECTOR_H_
+
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Largest power of two number of elements that fits in 4 KiB, but at least 16.
+template <class T>
+constexpr std::size_t default_segment_size() noexcept {
+  std::size_t count = 16;
+  while (count * 2 * sizeof(T) <= 4096) count *= 2;
+  return count;
+}
+
+// Vector made of fixed-size blocks reached through an index table. Growth
+// allocates one more block and never moves an element, so references,
+// pointers and iterators stay valid until the element is erased, and the
+// worst push_back costs one block allocation plus, rarely, a reallocation of
+// the table, which holds one pointer per BlockSize elements. Elements are
+// contiguous only within a block.
+template <class T, std::size_t BlockSize = default_segment_size<T>(),
+          class Allocator = std::allocator<T>>
+class segmented_vector {
+  static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0,
+                "BlockSize must be a power of two");
+
+ private:
+  using allocator_traits = std::allocator_traits<Allocator>;
+  using block_allocator =
+      typename allocator_traits::template rebind_alloc<T *>;
+
+  template <bool IsConst>
+  class common_iterator {
+   public:
+    using difference_type = ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T *, T *>;
+    using reference = std::conditional_t<IsConst, const T &, T &>;
+    using value_type = T;
+    using iterator_category = std::random_access_iterator_tag;
+    using container_type = std::conditional_t<IsConst, const segmented_vector,
+                                              segmented_vector>;
+
+    template <bool IsConstFriend>
+    friend class common_iterator;
+
+    common_iterator(container_type *vec, size_t pos) noexcept;
+    common_iterator() noexcept;
+
+    operator common_iterator<true>() const noexcept;
+
+    reference operator*() const;
+    pointer operator->() const;
+    reference operator[](difference_type n) const;
+
+    common_iterator<IsConst> &operator++();
+    common_iterator<IsConst> &operator--();
+    common_iterator<IsConst> operator++(int);
+    common_iterator<IsConst> operator--(int);
+    common_iterator<IsConst> operator+(difference_type n) const;
+    common_iterator<IsConst> operator-(difference_type n) const;
+    common_iterator<IsConst> &operator+=(difference_type n);
+    common_iterator<IsConst> &operator-=(difference_type n);
+    difference_type operator-(const common_iterator<true> &other) const;
+
+    inline bool operator==(const common_iterator<true> &other) const noexcept;
+    inline bool operator!=(const common_iterator<true> &other) const noexcept;
+    inline bool operator<(const common_iterator<true> &other) const noexcept;
+    inline bool operator>(const common_iterator<true> &other) const noexcept;
+    inline bool operator<=(const common_iterator<true> &other) const noexcept;
+    inline bool operator>=(const common_iterator<true> &other) const noexcept;
+
+   private:
+    container_type *_vec;
+    size_t _pos;
+  };
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = typename allocator_traits::pointer;
+  using const_pointer = typename allocator_traits::const_pointer;
+  using iterator = common_iterator<false>;
+  using const_iterator = common_iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr size_type block_size = BlockSize;
+
+  segmented_vector() noexcept(noexcept(Allocator()));
+  explicit segmented_vector(const Allocator &alloc) noexcept;
+  segmented_vector(size_type count, const T &value,
+                   const Allocator &alloc = Allocator());
+  explicit segmented_vector(size_type count,
+                            const Allocator &alloc = Allocator());
+  segmented_vector(std::initializer_list<T> init,
+                   const Allocator &alloc = Allocator());
+  segmented_vector(const segmented_vector &other);
+  segmented_vector(segmented_vector &&other) noexcept;
+  ~segmented_vector();
+  segmented_vector &operator=(const segmented_vector &other);
+  segmented_vector &operator=(segmented_vector &&other) noexcept(
+      allocator_traits::propagate_on_container_move_assignment::value ||
+      allocator_traits::is_always_equal::value);
+
+  allocator_type get_allocator() const noexcept;
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+  reverse_iterator rbegin() noexcept;
+  const_reverse_iterator rbegin() const noexcept;
+  const_reverse_iterator crbegin() const noexcept;
+  reverse_iterator rend() noexcept;
+  const_reverse_iterator rend() const noexcept;
+  const_reverse_iterator crend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(const T &value);
+  void push_back(T &&value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type count);
+  void resize(size_type count, const value_type &value);
+  void swap(segmented_vector &other) noexcept(
+      allocator_traits::propagate_on_container_swap::value ||
+      allocator_traits::is_always_equal::value);
+
+ private:
+  void add_block();
+  void release_blocks(size_type keep) noexcept;
+  void steal(segmented_vector &other) noexcept;
+
+  size_type _size;
+  vector<T *, block_allocator> _blocks;
+  Allocator _allocator;
+};
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator>::segmented_vector() noexcept(
+    noexcept(Allocator()))
+    : segmented_vector(Allocator()) {}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator>::segmented_vector(
+    const Allocator &alloc) noexcept
+    : _size(0), _blocks(block_allocator(alloc)), _allocator(alloc) {}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator>::segmented_vector(
+    size_type count, const T &value, const Allocator &alloc)
+    : segmented_vector(alloc) {
+  resize(count, value);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator>::segmented_vector(
+    size_type count, const Allocator &alloc)
+    : segmented_vector(alloc) {
+  resize(count);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator>::segmented_vector(
+    std::initializer_list<T> init, const Allocator &alloc)
+    : segmented_vector(alloc) {
+  reserve(init.size());
+  for (const T &value : init) push_back(value);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator>::segmented_vector(
+    const segmented_vector &other)
+    : segmented_vector(
+          allocator_traits::select_on_container_copy_construction(
+              other._allocator)) {
+  reserve(other._size);
+  for (const T &value : other) push_back(value);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator>::segmented_vector(
+    segmented_vector &&other) noexcept
+    : _size(other._size),
+      _blocks(std::move(other._blocks)),
+      _allocator(std::move(other._allocator)) {
+  other._size = 0;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator>::~segmented_vector() {
+  clear();
+  release_blocks(0);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator> &
+segmented_vector<T, BlockSize, Allocator>::operator=(
+    const segmented_vector &other) {
+  if (this == &other) return *this;
+  constexpr bool propagate =
+      allocator_traits::propagate_on_container_copy_assignment::value;
+  segmented_vector copy(propagate ? other._allocator : _allocator);
+  copy.reserve(other._size);
+  for (const T &value : other) copy.push_back(value);
+  clear();
+  release_blocks(0);
+  if constexpr (propagate) _allocator = other._allocator;
+  _size = copy._size;
+  _blocks = std::move(copy._blocks);
+  copy._size = 0;
+  return *this;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+segmented_vector<T, BlockSize, Allocator> &
+segmented_vector<T, BlockSize, Allocator>::operator=(
+    segmented_vector &&other) noexcept(
+    allocator_traits::propagate_on_container_move_assignment::value ||
+    allocator_traits::is_always_equal::value) {
+  if (this == &other) return *this;
+  if (allocator_traits::propagate_on_container_move_assignment::value ||
+      allocator_traits::is_always_equal::value ||
+      _allocator == other._allocator) {
+    steal(other);
+  } else {
+    clear();
+    reserve(other._size);
+    for (T &value : other) push_back(std::move(value));
+    other.clear();
+  }
+  return *this;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::allocator_type
+segmented_vector<T, BlockSize, Allocator>::get_allocator() const noexcept {
+  return _allocator;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::reference
+segmented_vector<T, BlockSize, Allocator>::at(size_type pos) {
+  if (pos >= _size) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_reference
+segmented_vector<T, BlockSize, Allocator>::at(size_type pos) const {
+  if (pos >= _size) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::reference
+segmented_vector<T, BlockSize, Allocator>::operator[](size_type pos) {
+  return _blocks[pos / BlockSize][pos % BlockSize];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_reference
+segmented_vector<T, BlockSize, Allocator>::operator[](size_type pos) const {
+  return _blocks[pos / BlockSize][pos % BlockSize];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::reference
+segmented_vector<T, BlockSize, Allocator>::front() {
+  return (*this)[0];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_reference
+segmented_vector<T, BlockSize, Allocator>::front() const {
+  return (*this)[0];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::reference
+segmented_vector<T, BlockSize, Allocator>::back() {
+  return (*this)[_size - 1];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_reference
+segmented_vector<T, BlockSize, Allocator>::back() const {
+  return (*this)[_size - 1];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::iterator
+segmented_vector<T, BlockSize, Allocator>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_iterator
+segmented_vector<T, BlockSize, Allocator>::begin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_iterator
+segmented_vector<T, BlockSize, Allocator>::cbegin() const noexcept {
+  return begin();
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::iterator
+segmented_vector<T, BlockSize, Allocator>::end() noexcept {
+  return iterator(this, _size);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_iterator
+segmented_vector<T, BlockSize, Allocator>::end() const noexcept {
+  return const_iterator(this, _size);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_iterator
+segmented_vector<T, BlockSize, Allocator>::cend() const noexcept {
+  return end();
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::reverse_iterator
+segmented_vector<T, BlockSize, Allocator>::rbegin() noexcept {
+  return reverse_iterator(end());
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_reverse_iterator
+segmented_vector<T, BlockSize, Allocator>::rbegin() const noexcept {
+  return const_reverse_iterator(end());
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_reverse_iterator
+segmented_vector<T, BlockSize, Allocator>::crbegin() const noexcept {
+  return rbegin();
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::reverse_iterator
+segmented_vector<T, BlockSize, Allocator>::rend() noexcept {
+  return reverse_iterator(begin());
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_reverse_iterator
+segmented_vector<T, BlockSize, Allocator>::rend() const noexcept {
+  return const_reverse_iterator(begin());
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::const_reverse_iterator
+segmented_vector<T, BlockSize, Allocator>::crend() const noexcept {
+  return rend();
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+bool segmented_vector<T, BlockSize, Allocator>::empty() const noexcept {
+  return _size == 0;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::size_type
+segmented_vector<T, BlockSize, Allocator>::size() const noexcept {
+  return _size;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::size_type
+segmented_vector<T, BlockSize, Allocator>::max_size() const noexcept {
+  return allocator_traits::max_size(_allocator);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::reserve(size_type new_cap) {
+  if (new_cap > max_size()) throw std::length_error("Too large size");
+  _blocks.reserve((new_cap + BlockSize - 1) / BlockSize);
+  while (capacity() < new_cap) add_block();
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+typename segmented_vector<T, BlockSize, Allocator>::size_type
+segmented_vector<T, BlockSize, Allocator>::capacity() const noexcept {
+  return _blocks.size() * BlockSize;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::shrink_to_fit() {
+  release_blocks((_size + BlockSize - 1) / BlockSize);
+  _blocks.shrink_to_fit();
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::clear() noexcept {
+  while (_size > 0) pop_back();
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::push_back(const T &value) {
+  emplace_back(value);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::push_back(T &&value) {
+  emplace_back(std::move(value));
+}
+
+// A full vector gets one new block; no existing element is touched, so a
+// throwing constructor leaves the vector unchanged apart from capacity.
+template <class T, std::size_t BlockSize, class Allocator>
+template <class... Args>
+typename segmented_vector<T, BlockSize, Allocator>::reference
+segmented_vector<T, BlockSize, Allocator>::emplace_back(Args &&...args) {
+  if (_size == capacity()) add_block();
+  T *slot = _blocks[_size / BlockSize] + _size % BlockSize;
+  allocator_traits::construct(_allocator, slot, std::forward<Args>(args)...);
+  ++_size;
+  return *slot;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::pop_back() {
+  --_size;
+  allocator_traits::destroy(_allocator,
+                            _blocks[_size / BlockSize] + _size % BlockSize);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::resize(size_type count) {
+  if (count > _size) reserve(count);
+  while (_size > count) pop_back();
+  while (_size < count) emplace_back();
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::resize(
+    size_type count, const value_type &value) {
+  if (count > _size) reserve(count);
+  while (_size > count) pop_back();
+  while (_size < count) emplace_back(value);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::swap(
+    segmented_vector &other) noexcept(
+    allocator_traits::propagate_on_container_swap::value ||
+    allocator_traits::is_always_equal::value) {
+  std::swap(_size, other._size);
+  _blocks.swap(other._blocks);
+  if constexpr (allocator_traits::propagate_on_container_swap::value)
+    std::swap(_allocator, other._allocator);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::add_block() {
+  T *block = allocator_traits::allocate(_allocator, BlockSize);
+  try {
+    _blocks.push_back(block);
+  } catch (...) {
+    allocator_traits::deallocate(_allocator, block, BlockSize);
+    throw;
+  }
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::release_blocks(
+    size_type keep) noexcept {
+  while (_blocks.size() > keep) {
+    allocator_traits::deallocate(_allocator, _blocks.back(), BlockSize);
+    _blocks.pop_back();
+  }
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+void segmented_vector<T, BlockSize, Allocator>::steal(
+    segmented_vector &other) noexcept {
+  clear();
+  release_blocks(0);
+  _size = other._size;
+  _blocks = std::move(other._blocks);
+  if constexpr (allocator_traits::propagate_on_container_move_assignment::
+                    value)
+    _allocator = std::move(other._allocator);
+  other._size = 0;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::common_iterator(container_type *vec, size_t pos) noexcept
+    : _vec(vec), _pos(pos) {}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::common_iterator() noexcept
+    : _vec(nullptr), _pos(0) {}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator common_iterator<true>() const noexcept {
+  return common_iterator<true>(_vec, _pos);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst>::reference
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator*() const {
+  return (*_vec)[_pos];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst>::pointer
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator->() const {
+  return &(*_vec)[_pos];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst>::reference
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator[](difference_type n) const {
+  return (*_vec)[_pos + n];
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst> &
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator++() {
+  ++_pos;
+  return *this;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst> &
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator--() {
+  --_pos;
+  return *this;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst>
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator++(int) {
+  common_iterator result = *this;
+  ++_pos;
+  return result;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst>
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator--(int) {
+  common_iterator result = *this;
+  --_pos;
+  return result;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst>
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator+(
+    difference_type n) const {
+  return common_iterator(_vec, _pos + n);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst>
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator-(
+    difference_type n) const {
+  return common_iterator(_vec, _pos - n);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst> &
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator+=(difference_type n) {
+  _pos += n;
+  return *this;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst> &
+segmented_vector<T, BlockSize, Allocator>::common_iterator<
+    IsConst>::operator-=(difference_type n) {
+  _pos -= n;
+  return *this;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+typename segmented_vector<T, BlockSize, Allocator>::template common_iterator<
+    IsConst>::difference_type
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator-(
+    const common_iterator<true> &other) const {
+  return static_cast<difference_type>(_pos) -
+         static_cast<difference_type>(other._pos);
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+inline bool
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator==(
+    const common_iterator<true> &other) const noexcept {
+  return _pos == other._pos;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+inline bool
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator!=(
+    const common_iterator<true> &other) const noexcept {
+  return _pos != other._pos;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+inline bool
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator<(
+    const common_iterator<true> &other) const noexcept {
+  return _pos < other._pos;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+inline bool
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator>(
+    const common_iterator<true> &other) const noexcept {
+  return _pos > other._pos;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+inline bool
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator<=(
+    const common_iterator<true> &other) const noexcept {
+  return _pos <= other._pos;
+}
+
+template <class T, std::size_t BlockSize, class Allocator>
+template <bool IsConst>
+inline bool
+segmented_vector<T, BlockSize, Allocator>::common_iterator<IsConst>::operator>=(
+    const common_iterator<true> &other) const noexcept {
+  return _pos >= other._pos;
+}
+
+}  // namespace s21
+
+#endif  // S21_SEGMENTED_VECTOR_H_
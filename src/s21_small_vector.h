@@ -0,0 +1,479 @@
+#ifndef S21_SMALL_VECTOR_H_
+#define S21_SMALL_VECTOR_H_
+
+#include <iostream>
+#include <iterator>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+template <class T, std::size_t N>
+struct small_vector_storage {
+  alignas(T) unsigned char _buffer[sizeof(T) * (N ? N : 1)];
+  bool _in_use = false;
+};
+
+// Hands out the inline buffer of a small_vector while it is free and can
+// hold the request, and forwards everything else to the wrapped allocator.
+template <class T, std::size_t N, class Allocator>
+class small_vector_allocator {
+ private:
+  using allocator_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using size_type = typename allocator_traits::size_type;
+  using difference_type = typename allocator_traits::difference_type;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::false_type;
+  using is_always_equal = std::false_type;
+
+  small_vector_allocator(small_vector_storage<T, N> *storage,
+                         const Allocator &alloc) noexcept;
+
+  T *allocate(size_type n);
+  void deallocate(T *p, size_type n) noexcept;
+  template <class U, class... Args>
+  void construct(U *p, Args &&...args);
+  template <class U>
+  void destroy(U *p);
+  size_type max_size() const noexcept;
+
+  T *inline_buffer() const noexcept;
+  const Allocator &base_allocator() const noexcept;
+
+  bool operator==(const small_vector_allocator &other) const noexcept;
+  bool operator!=(const small_vector_allocator &other) const noexcept;
+
+ private:
+  small_vector_storage<T, N> *_storage;
+  Allocator _allocator;
+};
+
+// The vector base is private: its pointer may refer to the inline buffer,
+// so swapping or move-assigning through a plain vector reference would
+// leave it dangling. The vector interface is re-exported member by member.
+template <class T, std::size_t N, class Allocator = std::allocator<T>>
+class small_vector
+    : private small_vector_storage<T, N>,
+      private vector<T, small_vector_allocator<T, N, Allocator>> {
+ private:
+  using base = vector<T, small_vector_allocator<T, N, Allocator>>;
+  using storage = small_vector_storage<T, N>;
+  using base_allocator_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using allocator_type = Allocator;
+  using typename base::const_iterator;
+  using typename base::const_pointer;
+  using typename base::const_reference;
+  using typename base::const_reverse_iterator;
+  using typename base::difference_type;
+  using typename base::iterator;
+  using typename base::pointer;
+  using typename base::reference;
+  using typename base::reverse_iterator;
+  using typename base::size_type;
+  using typename base::value_type;
+
+  static constexpr size_type inline_capacity = N;
+
+  small_vector() noexcept(noexcept(Allocator()));
+  explicit small_vector(const Allocator &alloc) noexcept;
+  small_vector(size_type count, const T &value,
+               const Allocator &alloc = Allocator());
+  explicit small_vector(size_type count, const Allocator &alloc = Allocator());
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  small_vector(InputIt first, InputIt last,
+               const Allocator &alloc = Allocator());
+  small_vector(const small_vector &other);
+  small_vector(const small_vector &other, const Allocator &alloc);
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  small_vector(small_vector &&other, const Allocator &alloc);
+  small_vector(std::initializer_list<T> init,
+               const Allocator &alloc = Allocator());
+  small_vector(vector<T, Allocator> &&other);
+  ~small_vector() = default;
+
+  small_vector &operator=(const small_vector &other);
+  small_vector &operator=(small_vector &&other) noexcept(
+      base_allocator_traits::is_always_equal::value &&
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>);
+  small_vector &operator=(std::initializer_list<T> ilist);
+  small_vector &operator=(vector<T, Allocator> &&other);
+
+  operator vector<T, Allocator>() const &;
+  operator vector<T, Allocator>() &&;
+
+  using base::assign;
+
+  using base::at;
+  using base::back;
+  using base::data;
+  using base::front;
+  using base::operator[];
+
+  using base::begin;
+  using base::cbegin;
+  using base::cend;
+  using base::crbegin;
+  using base::crend;
+  using base::end;
+  using base::rbegin;
+  using base::rend;
+
+  using base::capacity;
+  using base::empty;
+  using base::max_size;
+  using base::reserve;
+  using base::size;
+
+  using base::append;
+  using base::clear;
+  using base::emplace;
+  using base::emplace_back;
+  using base::emplace_back_n;
+  using base::erase;
+  using base::insert;
+  using base::pop_back;
+  using base::push_back;
+  using base::push_back_unchecked;
+  using base::resize;
+  using base::resize_for_overwrite;
+  using base::stats;
+
+  allocator_type get_allocator() const noexcept;
+  bool is_inline() const noexcept;
+  void shrink_to_fit();
+  void swap(small_vector &other) noexcept(
+      base_allocator_traits::is_always_equal::value &&
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>);
+
+ private:
+  small_vector_allocator<T, N, Allocator> make_allocator(
+      const Allocator &alloc) noexcept;
+  bool can_steal_from(const Allocator &alloc) const noexcept;
+  template <class Alloc>
+  void steal_heap_arr(vector<T, Alloc> &other) noexcept;
+  void reset() noexcept;
+};
+
+template <class T, std::size_t N, class Allocator>
+small_vector_allocator<T, N, Allocator>::small_vector_allocator(
+    small_vector_storage<T, N> *storage, const Allocator &alloc) noexcept
+    : _storage(storage), _allocator(alloc) {}
+
+template <class T, std::size_t N, class Allocator>
+T *small_vector_allocator<T, N, Allocator>::allocate(size_type n) {
+  if (n <= N && !_storage->_in_use) {
+    _storage->_in_use = true;
+    return inline_buffer();
+  }
+  return allocator_traits::allocate(_allocator, n);
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector_allocator<T, N, Allocator>::deallocate(T *p,
+                                                         size_type n) noexcept {
+  if (p == inline_buffer())
+    _storage->_in_use = false;
+  else
+    allocator_traits::deallocate(_allocator, p, n);
+}
+
+template <class T, std::size_t N, class Allocator>
+template <class U, class... Args>
+void small_vector_allocator<T, N, Allocator>::construct(U *p,
+                                                        Args &&...args) {
+  allocator_traits::construct(_allocator, p, std::forward<Args>(args)...);
+}
+
+template <class T, std::size_t N, class Allocator>
+template <class U>
+void small_vector_allocator<T, N, Allocator>::destroy(U *p) {
+  allocator_traits::destroy(_allocator, p);
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector_allocator<T, N, Allocator>::size_type
+small_vector_allocator<T, N, Allocator>::max_size() const noexcept {
+  return allocator_traits::max_size(_allocator);
+}
+
+template <class T, std::size_t N, class Allocator>
+T *small_vector_allocator<T, N, Allocator>::inline_buffer() const noexcept {
+  return reinterpret_cast<T *>(_storage->_buffer);
+}
+
+template <class T, std::size_t N, class Allocator>
+const Allocator &small_vector_allocator<T, N, Allocator>::base_allocator()
+    const noexcept {
+  return _allocator;
+}
+
+template <class T, std::size_t N, class Allocator>
+bool small_vector_allocator<T, N, Allocator>::operator==(
+    const small_vector_allocator &other) const noexcept {
+  return _storage == other._storage && _allocator == other._allocator;
+}
+
+template <class T, std::size_t N, class Allocator>
+bool small_vector_allocator<T, N, Allocator>::operator!=(
+    const small_vector_allocator &other) const noexcept {
+  return !(*this == other);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector() noexcept(noexcept(Allocator()))
+    : storage(), base(make_allocator(Allocator())) {
+  base::reserve(N);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(const Allocator &alloc) noexcept
+    : storage(), base(make_allocator(alloc)) {
+  base::reserve(N);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(size_type count, const T &value,
+                                            const Allocator &alloc)
+    : storage(), base(make_allocator(alloc)) {
+  base::reserve(N);
+  base::assign(count, value);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(size_type count,
+                                            const Allocator &alloc)
+    : storage(), base(make_allocator(alloc)) {
+  base::reserve(N);
+  base::resize(count);
+}
+
+template <class T, std::size_t N, class Allocator>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+small_vector<T, N, Allocator>::small_vector(InputIt first, InputIt last,
+                                            const Allocator &alloc)
+    : storage(), base(make_allocator(alloc)) {
+  base::reserve(N);
+  base::assign(first, last);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(const small_vector &other)
+    : storage(),
+      base(make_allocator(
+          base_allocator_traits::select_on_container_copy_construction(
+              other.get_allocator()))) {
+  base::reserve(N);
+  base::assign(other.begin(), other.end());
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(const small_vector &other,
+                                            const Allocator &alloc)
+    : storage(), base(make_allocator(alloc)) {
+  base::reserve(N);
+  base::assign(other.begin(), other.end());
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(small_vector &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : storage(), base(make_allocator(other.get_allocator())) {
+  if (other.is_inline()) {
+    base::reserve(N);
+    base::assign(std::make_move_iterator(other.begin()),
+                 std::make_move_iterator(other.end()));
+    other.clear();
+  } else {
+    steal_heap_arr(other);
+    other.reset();
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(small_vector &&other,
+                                            const Allocator &alloc)
+    : storage(), base(make_allocator(alloc)) {
+  if (other.is_inline() || !can_steal_from(other.get_allocator())) {
+    base::reserve(N);
+    base::assign(std::make_move_iterator(other.begin()),
+                 std::make_move_iterator(other.end()));
+    other.clear();
+  } else {
+    steal_heap_arr(other);
+    other.reset();
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(std::initializer_list<T> init,
+                                            const Allocator &alloc)
+    : storage(), base(make_allocator(alloc)) {
+  base::reserve(N);
+  base::assign(init);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::small_vector(vector<T, Allocator> &&other)
+    : storage(), base(make_allocator(other.get_allocator())) {
+  if (other._arr != nullptr) {
+    steal_heap_arr(other);
+  } else {
+    base::reserve(N);
+  }
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    const small_vector &other) {
+  if (this != &other) base::assign(other.begin(), other.end());
+  return *this;
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    small_vector &&other) noexcept(base_allocator_traits::is_always_equal::
+                                       value &&
+                                   std::is_nothrow_move_constructible_v<T> &&
+                                   std::is_nothrow_move_assignable_v<T>) {
+  if (this == &other) return *this;
+  if (other.is_inline() || !can_steal_from(other.get_allocator())) {
+    base::assign(std::make_move_iterator(other.begin()),
+                 std::make_move_iterator(other.end()));
+    other.clear();
+  } else {
+    base::clear();
+    base::deallocate_old_arr();
+    steal_heap_arr(other);
+    other.reset();
+  }
+  return *this;
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    std::initializer_list<T> ilist) {
+  base::assign(ilist);
+  return *this;
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator> &small_vector<T, N, Allocator>::operator=(
+    vector<T, Allocator> &&other) {
+  if (other._arr == nullptr || !can_steal_from(other.get_allocator())) {
+    base::assign(std::make_move_iterator(other.begin()),
+                 std::make_move_iterator(other.end()));
+    other.clear();
+  } else {
+    base::clear();
+    base::deallocate_old_arr();
+    steal_heap_arr(other);
+  }
+  return *this;
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::operator vector<T, Allocator>() const & {
+  return vector<T, Allocator>(base::begin(), base::end(), get_allocator());
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector<T, N, Allocator>::operator vector<T, Allocator>() && {
+  vector<T, Allocator> result(get_allocator());
+  if (is_inline()) {
+    result.reserve(base::size());
+    result.construct_at_end(std::make_move_iterator(base::begin()),
+                            std::make_move_iterator(base::end()));
+    base::clear();
+  } else {
+    result._arr = base::_arr;
+    result._size = base::_size;
+    result._capacity = base::_capacity;
+    reset();
+  }
+  return result;
+}
+
+template <class T, std::size_t N, class Allocator>
+typename small_vector<T, N, Allocator>::allocator_type
+small_vector<T, N, Allocator>::get_allocator() const noexcept {
+  return base::_allocator.base_allocator();
+}
+
+template <class T, std::size_t N, class Allocator>
+bool small_vector<T, N, Allocator>::is_inline() const noexcept {
+  return base::_arr == base::_allocator.inline_buffer();
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::shrink_to_fit() {
+  if (is_inline()) return;
+  if (base::_size > N) {
+    base::shrink_to_fit();
+    return;
+  }
+  T *new_arr = base::_allocator.allocate(N);
+  base::move_to_new_arr(new_arr, 0, base::_size, 0, N);
+  base::deallocate_old_arr();
+  base::_arr = new_arr;
+  base::_capacity = N;
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::swap(small_vector &other) noexcept(
+    base_allocator_traits::is_always_equal::value &&
+    std::is_nothrow_move_constructible_v<T> &&
+    std::is_nothrow_move_assignable_v<T>) {
+  if (this == &other) return;
+  small_vector temp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(temp);
+}
+
+template <class T, std::size_t N, class Allocator>
+small_vector_allocator<T, N, Allocator>
+small_vector<T, N, Allocator>::make_allocator(const Allocator &alloc) noexcept {
+  return small_vector_allocator<T, N, Allocator>(static_cast<storage *>(this),
+                                                 alloc);
+}
+
+template <class T, std::size_t N, class Allocator>
+bool small_vector<T, N, Allocator>::can_steal_from(
+    const Allocator &alloc) const noexcept {
+  return base_allocator_traits::is_always_equal::value ||
+         get_allocator() == alloc;
+}
+
+template <class T, std::size_t N, class Allocator>
+template <class Alloc>
+void small_vector<T, N, Allocator>::steal_heap_arr(
+    vector<T, Alloc> &other) noexcept {
+  base::_arr = other._arr;
+  base::_size = other._size;
+  base::_capacity = other._capacity;
+  other._arr = nullptr;
+  other._size = 0;
+  other._capacity = 0;
+}
+
+template <class T, std::size_t N, class Allocator>
+void small_vector<T, N, Allocator>::reset() noexcept {
+  base::_arr = nullptr;
+  base::_size = 0;
+  base::_capacity = 0;
+  base::reserve(N);
+}
+
+}  // namespace s21
+
+#endif  // S21_SMALL_VECTOR_H_
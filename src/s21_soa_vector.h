@@ -0,0 +1,592 @@
+#ifndef S21_SOA_VECTOR_H_
+#define S21_SOA_VECTOR_H_
+
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "s21_growth_policy.h"
+#include "s21_span.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Structure-of-arrays vector: each field of a row lives in its own
+// s21::vector, so a pass over one field streams through memory that holds
+// nothing else. Rows are read and written through tuples of references;
+// column<I>() exposes a field as a contiguous span. Every column uses
+// Allocator rebound to its field type and grows by GrowthPolicy, so all
+// columns keep the same capacity. soa_vector<Ts...> uses the defaults.
+template <class Allocator, class GrowthPolicy, class... Ts>
+class basic_soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+
+ private:
+  template <class T>
+  using column_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+  template <class T>
+  using column_vector = vector<T, column_allocator<T>, GrowthPolicy>;
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+
+  template <std::size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+
+ private:
+  template <bool IsConst>
+  class row_iterator {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::tuple<Ts...>;
+    using reference =
+        std::conditional_t<IsConst, basic_soa_vector::const_reference,
+                           basic_soa_vector::reference>;
+    using pointer = void;
+    using iterator_category = std::random_access_iterator_tag;
+    using container_type =
+        std::conditional_t<IsConst, const basic_soa_vector, basic_soa_vector>;
+
+    template <bool IsConstFriend>
+    friend class row_iterator;
+
+    row_iterator(container_type *soa, size_type pos) noexcept;
+    row_iterator() noexcept;
+
+    operator row_iterator<true>() const noexcept;
+
+    reference operator*() const;
+    reference operator[](difference_type n) const;
+
+    row_iterator &operator++();
+    row_iterator &operator--();
+    row_iterator operator++(int);
+    row_iterator operator--(int);
+    row_iterator operator+(difference_type n) const;
+    row_iterator operator-(difference_type n) const;
+    row_iterator &operator+=(difference_type n);
+    row_iterator &operator-=(difference_type n);
+    difference_type operator-(const row_iterator<true> &other) const;
+
+    friend row_iterator operator+(difference_type n, const row_iterator &it) {
+      return it + n;
+    }
+
+    bool operator==(const row_iterator<true> &other) const noexcept;
+    bool operator!=(const row_iterator<true> &other) const noexcept;
+    bool operator<(const row_iterator<true> &other) const noexcept;
+    bool operator>(const row_iterator<true> &other) const noexcept;
+    bool operator<=(const row_iterator<true> &other) const noexcept;
+    bool operator>=(const row_iterator<true> &other) const noexcept;
+
+   private:
+    container_type *_soa;
+    size_type _pos;
+  };
+
+ public:
+  using iterator = row_iterator<false>;
+  using const_iterator = row_iterator<true>;
+
+  basic_soa_vector() = default;
+  explicit basic_soa_vector(const Allocator &alloc);
+  explicit basic_soa_vector(size_type count,
+                            const Allocator &alloc = Allocator());
+  basic_soa_vector(std::initializer_list<value_type> init,
+                   const Allocator &alloc = Allocator());
+
+  allocator_type get_allocator() const noexcept;
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  template <std::size_t I>
+  span<column_type<I>> column() noexcept;
+  template <std::size_t I>
+  span<const column_type<I>> column() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  void push_back(const value_type &value);
+  void push_back(value_type &&value);
+  template <class... Args>
+  void emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type count);
+  void swap(basic_soa_vector &other) noexcept;
+
+ private:
+  template <std::size_t... I>
+  reference row(size_type pos, std::index_sequence<I...>);
+  template <std::size_t... I>
+  const_reference row(size_type pos, std::index_sequence<I...>) const;
+  template <class Tuple, std::size_t... I>
+  void push_row(Tuple &&values, std::index_sequence<I...>);
+  template <class Function>
+  void for_each_column(Function &&function);
+
+  std::tuple<column_vector<Ts>...> _columns;
+};
+
+template <class... Ts>
+using soa_vector =
+    basic_soa_vector<std::allocator<std::tuple<Ts...>>, doubling_growth, Ts...>;
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::basic_soa_vector(
+    const Allocator &alloc)
+    : _columns(column_vector<Ts>(column_allocator<Ts>(alloc))...) {}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::basic_soa_vector(
+    size_type count, const Allocator &alloc)
+    : basic_soa_vector(alloc) {
+  resize(count);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::basic_soa_vector(
+    std::initializer_list<value_type> init, const Allocator &alloc)
+    : basic_soa_vector(alloc) {
+  reserve(init.size());
+  for (const value_type &value : init) push_back(value);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::allocator_type
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::get_allocator()
+    const noexcept {
+  return Allocator(std::get<0>(_columns).get_allocator());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::at(size_type pos) {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::at(size_type pos) const {
+  if (pos >= size()) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::operator[](size_type pos) {
+  return row(pos, std::index_sequence_for<Ts...>());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::operator[](
+    size_type pos) const {
+  return row(pos, std::index_sequence_for<Ts...>());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::front() {
+  return (*this)[0];
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::front() const {
+  return (*this)[0];
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::back() {
+  return (*this)[size() - 1];
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::back() const {
+  return (*this)[size() - 1];
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <std::size_t I>
+span<typename basic_soa_vector<Allocator, GrowthPolicy,
+                               Ts...>::template column_type<I>>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::column() noexcept {
+  return span<column_type<I>>(std::get<I>(_columns).data(), size());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <std::size_t I>
+span<const typename basic_soa_vector<Allocator, GrowthPolicy,
+                                     Ts...>::template column_type<I>>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::column() const noexcept {
+  return span<const column_type<I>>(std::get<I>(_columns).data(), size());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::iterator
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_iterator
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::begin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_iterator
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::cbegin() const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::iterator
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::end() noexcept {
+  return iterator(this, size());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_iterator
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::end() const noexcept {
+  return const_iterator(this, size());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_iterator
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::cend() const noexcept {
+  return const_iterator(this, size());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+bool basic_soa_vector<Allocator, GrowthPolicy, Ts...>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::size_type
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::size() const noexcept {
+  return std::get<0>(_columns).size();
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::size_type
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::max_size() const noexcept {
+  return std::apply(
+      [](const auto &...columns) { return std::min({columns.max_size()...}); },
+      _columns);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::reserve(
+    size_type new_cap) {
+  for_each_column([new_cap](auto &column) { column.reserve(new_cap); });
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::size_type
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::capacity() const noexcept {
+  return std::apply(
+      [](const auto &...columns) { return std::min({columns.capacity()...}); },
+      _columns);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::shrink_to_fit() {
+  for_each_column([](auto &column) { column.shrink_to_fit(); });
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::clear() noexcept {
+  for_each_column([](auto &column) { column.clear(); });
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::push_back(
+    const value_type &value) {
+  push_row(value, std::index_sequence_for<Ts...>());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::push_back(
+    value_type &&value) {
+  push_row(std::move(value), std::index_sequence_for<Ts...>());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <class... Args>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::emplace_back(
+    Args &&...args) {
+  static_assert(sizeof...(Args) == sizeof...(Ts),
+                "emplace_back takes one argument per column");
+  push_row(std::forward_as_tuple(std::forward<Args>(args)...),
+           std::index_sequence_for<Ts...>());
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::pop_back() {
+  for_each_column([](auto &column) { column.pop_back(); });
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::resize(
+    size_type count) {
+  size_type old_size = size();
+  try {
+    for_each_column([count](auto &column) { column.resize(count); });
+  } catch (...) {
+    for_each_column([old_size](auto &column) {
+      if (column.size() > old_size) column.resize(old_size);
+    });
+    throw;
+  }
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::swap(
+    basic_soa_vector &other) noexcept {
+  _columns.swap(other._columns);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <std::size_t... I>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row(
+    size_type pos, std::index_sequence<I...>) {
+  return reference(std::get<I>(_columns)[pos]...);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <std::size_t... I>
+typename basic_soa_vector<Allocator, GrowthPolicy, Ts...>::const_reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row(
+    size_type pos, std::index_sequence<I...>) const {
+  return const_reference(std::get<I>(_columns)[pos]...);
+}
+
+// Appends one element to every column. If a column throws, the columns that
+// already grew are shrunk back, so all of them keep the same size.
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <class Tuple, std::size_t... I>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::push_row(
+    Tuple &&values, std::index_sequence<I...>) {
+  size_type old_size = size();
+  try {
+    (std::get<I>(_columns).emplace_back(
+         std::get<I>(std::forward<Tuple>(values))),
+     ...);
+  } catch (...) {
+    for_each_column([old_size](auto &column) {
+      if (column.size() > old_size) column.pop_back();
+    });
+    throw;
+  }
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <class Function>
+void basic_soa_vector<Allocator, GrowthPolicy, Ts...>::for_each_column(
+    Function &&function) {
+  std::apply([&function](auto &...columns) { (function(columns), ...); },
+             _columns);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::row_iterator(container_type *soa, size_type pos) noexcept
+    : _soa(soa), _pos(pos) {}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::row_iterator() noexcept
+    : _soa(nullptr), _pos(0) {}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator row_iterator<true>() const noexcept {
+  return row_iterator<true>(_soa, _pos);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst>::reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator*() const {
+  return (*_soa)[_pos];
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst>::reference
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator[](difference_type n) const {
+  return (*_soa)[_pos + n];
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst> &
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator++() {
+  ++_pos;
+  return *this;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst> &
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator--() {
+  --_pos;
+  return *this;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator++(int) {
+  row_iterator result = *this;
+  ++_pos;
+  return result;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator--(int) {
+  row_iterator result = *this;
+  --_pos;
+  return result;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator+(difference_type n) const {
+  return row_iterator(_soa, _pos + n);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst>
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator-(difference_type n) const {
+  return row_iterator(_soa, _pos - n);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst> &
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator+=(difference_type n) {
+  _pos += n;
+  return *this;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+typename basic_soa_vector<Allocator, GrowthPolicy,
+                          Ts...>::template row_iterator<IsConst> &
+basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator-=(difference_type n) {
+  _pos -= n;
+  return *this;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+std::ptrdiff_t basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator-(const row_iterator<true> &other) const {
+  return static_cast<difference_type>(_pos) -
+         static_cast<difference_type>(other._pos);
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+bool basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator==(const row_iterator<true> &other) const noexcept {
+  return _pos == other._pos;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+bool basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator!=(const row_iterator<true> &other) const noexcept {
+  return _pos != other._pos;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+bool basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator<(const row_iterator<true> &other) const noexcept {
+  return _pos < other._pos;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+bool basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator>(const row_iterator<true> &other) const noexcept {
+  return _pos > other._pos;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+bool basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator<=(const row_iterator<true> &other) const noexcept {
+  return _pos <= other._pos;
+}
+
+template <class Allocator, class GrowthPolicy, class... Ts>
+template <bool IsConst>
+bool basic_soa_vector<Allocator, GrowthPolicy, Ts...>::row_iterator<
+    IsConst>::operator>=(const row_iterator<true> &other) const noexcept {
+  return _pos >= other._pos;
+}
+
+}  // namespace s21
+
+#endif  // S21_SOA_VECTOR_H_
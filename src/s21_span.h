@@ -0,0 +1,143 @@
+#ifndef S21_SPAN_H_
+#define S21_SPAN_H_
+
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+namespace s21 {
+
+// Non-owning view of count contiguous elements, for handing a column or a
+// buffer to a loop without exposing the container that owns it.
+template <class T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+
+  constexpr span() noexcept;
+  constexpr span(T *data, size_type count) noexcept;
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>, bool> =
+                true>
+  constexpr span(const span<U> &other) noexcept;
+
+  constexpr reference operator[](size_type pos) const;
+  constexpr reference front() const;
+  constexpr reference back() const;
+  constexpr T *data() const noexcept;
+
+  constexpr iterator begin() const noexcept;
+  constexpr iterator end() const noexcept;
+  constexpr reverse_iterator rbegin() const noexcept;
+  constexpr reverse_iterator rend() const noexcept;
+
+  constexpr bool empty() const noexcept;
+  constexpr size_type size() const noexcept;
+  constexpr size_type size_bytes() const noexcept;
+
+  constexpr span first(size_type count) const;
+  constexpr span last(size_type count) const;
+  constexpr span subspan(size_type offset, size_type count) const;
+
+ private:
+  T *_data;
+  size_type _size;
+};
+
+template <class T>
+constexpr span<T>::span() noexcept : _data(nullptr), _size(0) {}
+
+template <class T>
+constexpr span<T>::span(T *data, size_type count) noexcept
+    : _data(data), _size(count) {}
+
+template <class T>
+template <class U,
+          std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>, bool>>
+constexpr span<T>::span(const span<U> &other) noexcept
+    : _data(other.data()), _size(other.size()) {}
+
+template <class T>
+constexpr typename span<T>::reference span<T>::operator[](
+    size_type pos) const {
+  return _data[pos];
+}
+
+template <class T>
+constexpr typename span<T>::reference span<T>::front() const {
+  return _data[0];
+}
+
+template <class T>
+constexpr typename span<T>::reference span<T>::back() const {
+  return _data[_size - 1];
+}
+
+template <class T>
+constexpr T *span<T>::data() const noexcept {
+  return _data;
+}
+
+template <class T>
+constexpr typename span<T>::iterator span<T>::begin() const noexcept {
+  return _data;
+}
+
+template <class T>
+constexpr typename span<T>::iterator span<T>::end() const noexcept {
+  return _data + _size;
+}
+
+template <class T>
+constexpr typename span<T>::reverse_iterator span<T>::rbegin()
+    const noexcept {
+  return reverse_iterator(end());
+}
+
+template <class T>
+constexpr typename span<T>::reverse_iterator span<T>::rend() const noexcept {
+  return reverse_iterator(begin());
+}
+
+template <class T>
+constexpr bool span<T>::empty() const noexcept {
+  return _size == 0;
+}
+
+template <class T>
+constexpr typename span<T>::size_type span<T>::size() const noexcept {
+  return _size;
+}
+
+template <class T>
+constexpr typename span<T>::size_type span<T>::size_bytes() const noexcept {
+  return _size * sizeof(T);
+}
+
+template <class T>
+constexpr span<T> span<T>::first(size_type count) const {
+  return span(_data, count);
+}
+
+template <class T>
+constexpr span<T> span<T>::last(size_type count) const {
+  return span(_data + _size - count, count);
+}
+
+template <class T>
+constexpr span<T> span<T>::subspan(size_type offset, size_type count) const {
+  return span(_data + offset, count);
+}
+
+}  // namespace s21
+
+#endif  // S21_SPAN_H_
@@ -0,0 +1,685 @@
+#ifndef S21_STATIC_VECTOR_H_
+#define S21_STATIC_VECTOR_H_
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "s21_memory.h"
+
+namespace s21 {
+
+// Overflow policies of static_vector, called when an operation would grow it
+// past its capacity. abort_on_overflow is for code built without
+// exceptions; it stops the program in every build mode, since returning
+// would let the caller construct past the buffer.
+struct throw_on_overflow {
+  static void overflow();
+};
+
+struct abort_on_overflow {
+  [[noreturn]] static void overflow() noexcept;
+};
+
+// Inline storage of a static_vector. The primary template copies, moves and
+// destroys the live elements; the specialization for trivially copyable
+// types keeps every special member trivial, so such a static_vector can be
+// copied with memcpy into queues or shared memory.
+template <class T, std::size_t Capacity,
+          bool = std::is_trivially_copyable_v<T>>
+struct static_vector_storage {
+  static_vector_storage() noexcept = default;
+  static_vector_storage(const static_vector_storage &other);
+  static_vector_storage(static_vector_storage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~static_vector_storage();
+  static_vector_storage &operator=(const static_vector_storage &other);
+  static_vector_storage &operator=(static_vector_storage &&other) noexcept(
+      std::is_nothrow_move_assignable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>);
+
+  T *elements() noexcept;
+  const T *elements() const noexcept;
+
+  std::size_t _size = 0;
+  alignas(T) unsigned char _buffer[sizeof(T) * (Capacity ? Capacity : 1)];
+};
+
+template <class T, std::size_t Capacity>
+struct static_vector_storage<T, Capacity, true> {
+  T *elements() noexcept;
+  const T *elements() const noexcept;
+
+  std::size_t _size = 0;
+  alignas(T) unsigned char _buffer[sizeof(T) * (Capacity ? Capacity : 1)];
+};
+
+template <class T, std::size_t Capacity,
+          class OverflowPolicy = throw_on_overflow>
+class static_vector : private static_vector_storage<T, Capacity> {
+ private:
+  using storage = static_vector_storage<T, Capacity>;
+  using storage::_size;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr size_type static_capacity = Capacity;
+
+  static_vector() noexcept;
+  static_vector(size_type count, const T &value);
+  explicit static_vector(size_type count);
+  static_vector(size_type count, default_init_t);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  static_vector(InputIt first, InputIt last);
+  static_vector(std::initializer_list<T> init);
+  static_vector &operator=(std::initializer_list<T> ilist);
+  void assign(size_type count, const T &value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<T> ilist);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  T *data() noexcept;
+  const T *data() const noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+  reverse_iterator rbegin() noexcept;
+  const_reverse_iterator rbegin() const noexcept;
+  const_reverse_iterator crbegin() const noexcept;
+  reverse_iterator rend() noexcept;
+  const_reverse_iterator rend() const noexcept;
+  const_reverse_iterator crend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept;
+  void shrink_to_fit() noexcept;
+
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const T &value);
+  iterator insert(const_iterator pos, T &&value);
+  iterator insert(const_iterator pos, size_type count, const T &value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, std::initializer_list<T> ilist);
+  void erase(const_iterator pos);
+  void erase(const_iterator first, const_iterator last);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  void push_back(const T &value);
+  void push_back(T &&value);
+  template <class... Args>
+  void emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type count);
+  void resize(size_type count, const value_type &value);
+  void resize(size_type count, default_init_t);
+  void resize_for_overwrite(size_type count);
+  void swap(static_vector &other) noexcept(
+      std::is_nothrow_swappable_v<T> &&
+      std::is_nothrow_move_constructible_v<T>);
+
+ private:
+  void check_capacity(size_type count) const;
+  void destroy_at_end(size_type new_size) noexcept;
+};
+
+inline void throw_on_overflow::overflow() {
+  throw std::length_error("static_vector capacity exceeded");
+}
+
+inline void abort_on_overflow::overflow() noexcept {
+  std::fputs("static_vector capacity exceeded\n", stderr);
+  std::abort();
+}
+
+template <class T, std::size_t Capacity, bool Trivial>
+static_vector_storage<T, Capacity, Trivial>::static_vector_storage(
+    const static_vector_storage &other) {
+  std::uninitialized_copy_n(other.elements(), other._size, elements());
+  _size = other._size;
+}
+
+template <class T, std::size_t Capacity, bool Trivial>
+static_vector_storage<T, Capacity, Trivial>::static_vector_storage(
+    static_vector_storage &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
+  std::uninitialized_move_n(other.elements(), other._size, elements());
+  _size = other._size;
+}
+
+template <class T, std::size_t Capacity, bool Trivial>
+static_vector_storage<T, Capacity, Trivial>::~static_vector_storage() {
+  std::destroy_n(elements(), _size);
+}
+
+template <class T, std::size_t Capacity, bool Trivial>
+static_vector_storage<T, Capacity, Trivial> &
+static_vector_storage<T, Capacity, Trivial>::operator=(
+    const static_vector_storage &other) {
+  if (this == &other) return *this;
+  if (other._size <= _size) {
+    std::copy_n(other.elements(), other._size, elements());
+    std::destroy(elements() + other._size, elements() + _size);
+  } else {
+    std::copy_n(other.elements(), _size, elements());
+    std::uninitialized_copy(other.elements() + _size,
+                            other.elements() + other._size,
+                            elements() + _size);
+  }
+  _size = other._size;
+  return *this;
+}
+
+template <class T, std::size_t Capacity, bool Trivial>
+static_vector_storage<T, Capacity, Trivial> &
+static_vector_storage<T, Capacity, Trivial>::operator=(
+    static_vector_storage &&other) noexcept(
+    std::is_nothrow_move_assignable_v<T> &&
+    std::is_nothrow_move_constructible_v<T>) {
+  if (this == &other) return *this;
+  if (other._size <= _size) {
+    std::move(other.elements(), other.elements() + other._size, elements());
+    std::destroy(elements() + other._size, elements() + _size);
+  } else {
+    std::move(other.elements(), other.elements() + _size, elements());
+    std::uninitialized_move(other.elements() + _size,
+                            other.elements() + other._size,
+                            elements() + _size);
+  }
+  _size = other._size;
+  return *this;
+}
+
+template <class T, std::size_t Capacity, bool Trivial>
+T *static_vector_storage<T, Capacity, Trivial>::elements() noexcept {
+  return reinterpret_cast<T *>(_buffer);
+}
+
+template <class T, std::size_t Capacity, bool Trivial>
+const T *static_vector_storage<T, Capacity, Trivial>::elements()
+    const noexcept {
+  return reinterpret_cast<const T *>(_buffer);
+}
+
+template <class T, std::size_t Capacity>
+T *static_vector_storage<T, Capacity, true>::elements() noexcept {
+  return reinterpret_cast<T *>(_buffer);
+}
+
+template <class T, std::size_t Capacity>
+const T *static_vector_storage<T, Capacity, true>::elements() const noexcept {
+  return reinterpret_cast<const T *>(_buffer);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+static_vector<T, Capacity, OverflowPolicy>::static_vector() noexcept {}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+static_vector<T, Capacity, OverflowPolicy>::static_vector(size_type count,
+                                                          const T &value) {
+  check_capacity(count);
+  std::uninitialized_fill_n(data(), count, value);
+  _size = count;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+static_vector<T, Capacity, OverflowPolicy>::static_vector(size_type count) {
+  check_capacity(count);
+  std::uninitialized_value_construct_n(data(), count);
+  _size = count;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+static_vector<T, Capacity, OverflowPolicy>::static_vector(size_type count,
+                                                          default_init_t) {
+  check_capacity(count);
+  std::uninitialized_default_construct_n(data(), count);
+  _size = count;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+static_vector<T, Capacity, OverflowPolicy>::static_vector(InputIt first,
+                                                          InputIt last) {
+  size_type count = std::distance(first, last);
+  check_capacity(count);
+  std::uninitialized_copy(first, last, data());
+  _size = count;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+static_vector<T, Capacity, OverflowPolicy>::static_vector(
+    std::initializer_list<T> init)
+    : static_vector(init.begin(), init.end()) {}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+static_vector<T, Capacity, OverflowPolicy> &
+static_vector<T, Capacity, OverflowPolicy>::operator=(
+    std::initializer_list<T> ilist) {
+  assign(ilist.begin(), ilist.end());
+  return *this;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::assign(size_type count,
+                                                        const T &value) {
+  check_capacity(count);
+  if (count <= _size) {
+    std::fill_n(data(), count, value);
+    destroy_at_end(count);
+  } else {
+    std::fill_n(data(), _size, value);
+    std::uninitialized_fill_n(end(), count - _size, value);
+    _size = count;
+  }
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+void static_vector<T, Capacity, OverflowPolicy>::assign(InputIt first,
+                                                        InputIt last) {
+  size_type count = std::distance(first, last);
+  check_capacity(count);
+  if (count <= _size) {
+    std::copy(first, last, data());
+    destroy_at_end(count);
+  } else {
+    InputIt mid = std::next(first, _size);
+    std::copy(first, mid, data());
+    std::uninitialized_copy(mid, last, end());
+    _size = count;
+  }
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::assign(
+    std::initializer_list<T> ilist) {
+  assign(ilist.begin(), ilist.end());
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::reference
+static_vector<T, Capacity, OverflowPolicy>::at(size_type pos) {
+  if (pos >= _size) throw std::out_of_range("Index out of range");
+  return data()[pos];
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_reference
+static_vector<T, Capacity, OverflowPolicy>::at(size_type pos) const {
+  if (pos >= _size) throw std::out_of_range("Index out of range");
+  return data()[pos];
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::reference
+static_vector<T, Capacity, OverflowPolicy>::operator[](size_type pos) {
+  return data()[pos];
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_reference
+static_vector<T, Capacity, OverflowPolicy>::operator[](size_type pos) const {
+  return data()[pos];
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::reference
+static_vector<T, Capacity, OverflowPolicy>::front() {
+  return *begin();
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_reference
+static_vector<T, Capacity, OverflowPolicy>::front() const {
+  return *cbegin();
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::reference
+static_vector<T, Capacity, OverflowPolicy>::back() {
+  return *(end() - 1);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_reference
+static_vector<T, Capacity, OverflowPolicy>::back() const {
+  return *(cend() - 1);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+T *static_vector<T, Capacity, OverflowPolicy>::data() noexcept {
+  return storage::elements();
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+const T *static_vector<T, Capacity, OverflowPolicy>::data() const noexcept {
+  return storage::elements();
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::iterator
+static_vector<T, Capacity, OverflowPolicy>::begin() noexcept {
+  return data();
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_iterator
+static_vector<T, Capacity, OverflowPolicy>::begin() const noexcept {
+  return data();
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_iterator
+static_vector<T, Capacity, OverflowPolicy>::cbegin() const noexcept {
+  return data();
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::iterator
+static_vector<T, Capacity, OverflowPolicy>::end() noexcept {
+  return data() + _size;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_iterator
+static_vector<T, Capacity, OverflowPolicy>::end() const noexcept {
+  return data() + _size;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_iterator
+static_vector<T, Capacity, OverflowPolicy>::cend() const noexcept {
+  return data() + _size;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::reverse_iterator
+static_vector<T, Capacity, OverflowPolicy>::rbegin() noexcept {
+  return reverse_iterator(end());
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_reverse_iterator
+static_vector<T, Capacity, OverflowPolicy>::rbegin() const noexcept {
+  return const_reverse_iterator(cend());
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_reverse_iterator
+static_vector<T, Capacity, OverflowPolicy>::crbegin() const noexcept {
+  return const_reverse_iterator(cend());
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::reverse_iterator
+static_vector<T, Capacity, OverflowPolicy>::rend() noexcept {
+  return reverse_iterator(begin());
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_reverse_iterator
+static_vector<T, Capacity, OverflowPolicy>::rend() const noexcept {
+  return const_reverse_iterator(cbegin());
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::const_reverse_iterator
+static_vector<T, Capacity, OverflowPolicy>::crend() const noexcept {
+  return const_reverse_iterator(cbegin());
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+bool static_vector<T, Capacity, OverflowPolicy>::empty() const noexcept {
+  return _size == 0;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::size_type
+static_vector<T, Capacity, OverflowPolicy>::size() const noexcept {
+  return _size;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::size_type
+static_vector<T, Capacity, OverflowPolicy>::max_size() const noexcept {
+  return Capacity;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::reserve(size_type new_cap) {
+  check_capacity(new_cap);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::size_type
+static_vector<T, Capacity, OverflowPolicy>::capacity() const noexcept {
+  return Capacity;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::shrink_to_fit() noexcept {}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::clear() noexcept {
+  destroy_at_end(0);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::iterator
+static_vector<T, Capacity, OverflowPolicy>::insert(const_iterator pos,
+                                                   const T &value) {
+  return emplace(pos, value);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::iterator
+static_vector<T, Capacity, OverflowPolicy>::insert(const_iterator pos,
+                                                   T &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// The multi-element inserts construct the new elements at the end first, so
+// they may refer to elements of the vector itself, and rotate them into
+// place afterwards.
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::iterator
+static_vector<T, Capacity, OverflowPolicy>::insert(const_iterator pos,
+                                                   size_type count,
+                                                   const T &value) {
+  size_type insert_pos = pos - cbegin();
+  check_capacity(_size + count);
+  std::uninitialized_fill_n(end(), count, value);
+  _size += count;
+  std::rotate(begin() + insert_pos, end() - count, end());
+  return begin() + insert_pos;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+typename static_vector<T, Capacity, OverflowPolicy>::iterator
+static_vector<T, Capacity, OverflowPolicy>::insert(const_iterator pos,
+                                                   InputIt first,
+                                                   InputIt last) {
+  size_type insert_pos = pos - cbegin();
+  size_type count = std::distance(first, last);
+  check_capacity(_size + count);
+  std::uninitialized_copy(first, last, end());
+  _size += count;
+  std::rotate(begin() + insert_pos, end() - count, end());
+  return begin() + insert_pos;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+typename static_vector<T, Capacity, OverflowPolicy>::iterator
+static_vector<T, Capacity, OverflowPolicy>::insert(
+    const_iterator pos, std::initializer_list<T> ilist) {
+  return insert(pos, ilist.begin(), ilist.end());
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::erase(const_iterator pos) {
+  erase(pos, pos + 1);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::erase(const_iterator first,
+                                                       const_iterator last) {
+  if (first == last) return;
+  iterator dest = begin() + (first - cbegin());
+  iterator source = begin() + (last - cbegin());
+  std::move(source, end(), dest);
+  destroy_at_end(_size - (last - first));
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+template <class... Args>
+typename static_vector<T, Capacity, OverflowPolicy>::iterator
+static_vector<T, Capacity, OverflowPolicy>::emplace(const_iterator pos,
+                                                    Args &&...args) {
+  size_type insert_pos = pos - cbegin();
+  if (insert_pos == _size) {
+    emplace_back(std::forward<Args>(args)...);
+  } else {
+    check_capacity(_size + 1);
+    T value(std::forward<Args>(args)...);
+    ::new (static_cast<void *>(end())) T(std::move(back()));
+    ++_size;
+    std::move_backward(begin() + insert_pos, end() - 2, end() - 1);
+    data()[insert_pos] = std::move(value);
+  }
+  return begin() + insert_pos;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::push_back(const T &value) {
+  emplace_back(value);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::push_back(T &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+template <class... Args>
+void static_vector<T, Capacity, OverflowPolicy>::emplace_back(
+    Args &&...args) {
+  check_capacity(_size + 1);
+  ::new (static_cast<void *>(end())) T(std::forward<Args>(args)...);
+  ++_size;
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::pop_back() {
+  destroy_at_end(_size - 1);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::resize(size_type count) {
+  if (count <= _size) {
+    destroy_at_end(count);
+  } else {
+    check_capacity(count);
+    std::uninitialized_value_construct_n(end(), count - _size);
+    _size = count;
+  }
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::resize(
+    size_type count, const value_type &value) {
+  if (count <= _size) {
+    destroy_at_end(count);
+  } else {
+    check_capacity(count);
+    std::uninitialized_fill_n(end(), count - _size, value);
+    _size = count;
+  }
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::resize(size_type count,
+                                                        default_init_t) {
+  if (count <= _size) {
+    destroy_at_end(count);
+  } else {
+    check_capacity(count);
+    std::uninitialized_default_construct_n(end(), count - _size);
+    _size = count;
+  }
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::resize_for_overwrite(
+    size_type count) {
+  resize(count, default_init);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::swap(
+    static_vector &other) noexcept(std::is_nothrow_swappable_v<T> &&
+                                   std::is_nothrow_move_constructible_v<T>) {
+  static_vector &shorter = _size <= other._size ? *this : other;
+  static_vector &longer = _size <= other._size ? other : *this;
+  size_type common = shorter._size;
+  std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+  std::uninitialized_move(longer.begin() + common, longer.end(),
+                          shorter.end());
+  shorter._size = longer._size;
+  longer.destroy_at_end(common);
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::check_capacity(
+    size_type count) const {
+  if (count > Capacity) OverflowPolicy::overflow();
+}
+
+template <class T, std::size_t Capacity, class OverflowPolicy>
+void static_vector<T, Capacity, OverflowPolicy>::destroy_at_end(
+    size_type new_size) noexcept {
+  std::destroy(data() + new_size, end());
+  _size = new_size;
+}
+
+}  // namespace s21
+
+#endif  // S21_STATIC_VECTOR_H_
@@ -1,12 +1,22 @@
 #ifndef S21_VECTOR_H_
 #define S21_VECTOR_H_
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
 #include <iostream>
+#include <iterator>
+
+#include "s21_growth_policy.h"
+#include "s21_memory.h"
+#include "s21_vector_stats.h"
 
 namespace s21 {
 
-template <class T, class Allocator = std::allocator<T>>
-class vector {
+template <class T, class Allocator = std::allocator<T>,
+          class GrowthPolicy = doubling_growth,
+          class StatsPolicy = no_vector_stats>
+class vector : private StatsPolicy {
  private:
   using allocator_traits = std::allocator_traits<Allocator>;
 
@@ -20,6 +30,7 @@ class vector {
     using reference = std::conditional_t<IsConst, const T &, T &>;
     using value_type = T;
     using iterator_category = std::random_access_iterator_tag;
+    using is_contiguous = std::true_type;
 
     template <bool IsConstFriend>
     friend class common_iterator;
@@ -72,6 +83,8 @@ class vector {
   explicit vector(const Allocator &alloc) noexcept;
   vector(size_type count, const T &value, const Allocator &alloc = Allocator());
   explicit vector(size_type count, const Allocator &alloc = Allocator());
+  vector(size_type count, default_init_t,
+         const Allocator &alloc = Allocator());
   template <class InputIt,
             std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
   vector(InputIt first, InputIt last, const Allocator &alloc = Allocator());
@@ -82,9 +95,9 @@ class vector {
   vector(std::initializer_list<T> init, const Allocator &alloc = Allocator());
   ~vector();
   vector &operator=(const vector &other);
-  vector &operator=(vector &&other) noexcept(noexcept(
+  vector &operator=(vector &&other) noexcept(
       allocator_traits::propagate_on_container_move_assignment::value ||
-      allocator_traits::is_always_equal::value));
+      allocator_traits::is_always_equal::value);
   vector &operator=(std::initializer_list<T> ilist);
   void assign(size_type count, const T &value);
   template <class InputIt,
@@ -140,12 +153,22 @@ class vector {
   void push_back(T &&value);
   template <class... Args>
   void emplace_back(Args &&...args);
+  template <class... Args>
+  void emplace_back_n(size_type count, Args &&...args);
+  void push_back_unchecked(const T &value);
+  void push_back_unchecked(T &&value);
+  template <class InputIt,
+            std::enable_if_t<!std::is_integral<InputIt>::value, bool> = true>
+  void append(InputIt first, InputIt last);
   void pop_back();
   void resize(size_type count);
   void resize(size_type count, const value_type &value);
+  void resize(size_type count, default_init_t);
+  void resize_for_overwrite(size_type count);
   void swap(vector &other) noexcept(
-      noexcept(allocator_traits::propagate_on_container_swap::value ||
-               allocator_traits::is_always_equal::value));
+      allocator_traits::propagate_on_container_swap::value ||
+      allocator_traits::is_always_equal::value);
+  vector_counters stats() const noexcept;
 
  private:
   void move_to_new_arr(T *new_arr, size_type pos, size_type count,
@@ -158,68 +181,126 @@ class vector {
   void copy_to_new_arr(T *new_arr, size_type pos, InputIt first, InputIt last,
                        size_type capacity_to_deallocate);
   void shift_elements(const_iterator pos, size_type shift, bool to_right);
+  void replace_arr(T *new_arr, size_type new_cap);
+  void record_transfer(size_type count) noexcept;
+  void construct_at_end(size_type count);
+  void construct_at_end(size_type count, const T &value);
+  void construct_at_end(size_type count, default_init_t);
+  template <class InputIt>
+  void construct_at_end(InputIt first, InputIt last);
+  template <class... Args>
+  void emplace_back_grow(size_type count, Args &&...args);
+  void destroy_at_end(size_type new_size) noexcept;
+  template <class InputIt>
+  void assign_range(InputIt first, InputIt last, size_type count);
   size_type calculate_capacity(size_type count);
+  bool try_resize_in_place(size_type new_cap);
   void deallocate_old_arr();
 
+  template <class U, std::size_t M, class Alloc>
+  friend class small_vector;
+
   size_type _size;
   size_type _capacity;
   pointer _arr;
   Allocator _allocator;
 };
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector() noexcept(noexcept(Allocator()))
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector()
+    noexcept(noexcept(Allocator()))
     : _size(0), _capacity(0), _arr(nullptr), _allocator(Allocator()) {}
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector(const Allocator &alloc) noexcept
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(const Allocator &alloc)
+    noexcept
     : _size(0), _capacity(0), _arr(nullptr), _allocator(alloc) {}
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector(size_type count, const T &value,
-                             const Allocator &alloc)
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(
+    size_type count, const T &value, const Allocator &alloc)
+    : _size(0), _capacity(0), _arr(nullptr), _allocator(alloc) {
+  reserve(count);
+  try {
+    construct_at_end(count, value);
+  } catch (...) {
+    deallocate_old_arr();
+    throw;
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(
+    size_type count, const Allocator &alloc)
     : _size(0), _capacity(0), _arr(nullptr), _allocator(alloc) {
   reserve(count);
-  while (_size != count) push_back(value);
+  try {
+    construct_at_end(count);
+  } catch (...) {
+    deallocate_old_arr();
+    throw;
+  }
 }
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector(size_type count, const Allocator &alloc)
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(
+    size_type count, default_init_t, const Allocator &alloc)
     : _size(0), _capacity(0), _arr(nullptr), _allocator(alloc) {
   reserve(count);
-  while (_size != count) push_back(T());
+  try {
+    construct_at_end(count, default_init);
+  } catch (...) {
+    deallocate_old_arr();
+    throw;
+  }
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <class InputIt,
           std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
-vector<T, Allocator>::vector(InputIt first, InputIt last,
-                             const Allocator &alloc)
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(
+    InputIt first, InputIt last, const Allocator &alloc)
     : _size(0), _capacity(0), _arr(nullptr), _allocator(alloc) {
   reserve(last - first);
-  for (; first != last; ++first) push_back(*first);
+  try {
+    construct_at_end(first, last);
+  } catch (...) {
+    deallocate_old_arr();
+    throw;
+  }
 }
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector(const vector &other)
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(const vector &other)
     : _size(0),
       _capacity(0),
       _arr(nullptr),
       _allocator(allocator_traits::select_on_container_copy_construction(
           other.get_allocator())) {
-  reserve(other._capacity);
-  for (auto it = other.begin(); it != other.end(); ++it) push_back(*it);
+  reserve(other._size);
+  try {
+    construct_at_end(other.begin(), other.end());
+  } catch (...) {
+    deallocate_old_arr();
+    throw;
+  }
 }
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector(const vector &other, const Allocator &alloc)
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(
+    const vector &other, const Allocator &alloc)
     : _size(0), _capacity(0), _arr(nullptr), _allocator(alloc) {
-  reserve(other._capacity);
-  for (auto it = other.begin(); it != other.end(); ++it) push_back(*it);
+  reserve(other._size);
+  try {
+    construct_at_end(other.begin(), other.end());
+  } catch (...) {
+    deallocate_old_arr();
+    throw;
+  }
 }
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector(vector &&other) noexcept
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(vector &&other) noexcept
     : _size(other._size),
       _capacity(other._capacity),
       _arr(other._arr),
@@ -229,309 +310,344 @@ vector<T, Allocator>::vector(vector &&other) noexcept
   other._arr = nullptr;
 }
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector(vector &&other, const Allocator &alloc)
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(
+    vector &&other, const Allocator &alloc)
     : _size(0), _capacity(0), _arr(nullptr), _allocator(alloc) {
-  if (_allocator == other.get_allocator()) {
-    reserve(other._capacity);
-    for (auto it = other.begin(); it != other.end(); ++it) {
-      push_back(std::move(*it));
-    }
-    other.clear();
-    other.shrink_to_fit();
-  } else {
+  if (_allocator == other._allocator) {
+    _size = other._size;
+    _capacity = other._capacity;
+    _arr = other._arr;
     other._size = 0;
     other._capacity = 0;
-    _arr = other._arr;
+    other._arr = nullptr;
+    return;
   }
-  other._arr = nullptr;
+  reserve(other._size);
+  try {
+    construct_at_end(std::make_move_iterator(other.begin()),
+                     std::make_move_iterator(other.end()));
+  } catch (...) {
+    deallocate_old_arr();
+    throw;
+  }
+  other.clear();
 }
 
-template <class T, class Allocator>
-vector<T, Allocator>::vector(std::initializer_list<T> init,
-                             const Allocator &alloc)
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::vector(
+    std::initializer_list<T> init, const Allocator &alloc)
     : _size(0), _capacity(0), _arr(nullptr), _allocator(alloc) {
   reserve(init.size());
-  for (auto it = init.begin(); it != init.end(); ++it) push_back(*it);
+  try {
+    construct_at_end(init.begin(), init.end());
+  } catch (...) {
+    deallocate_old_arr();
+    throw;
+  }
 }
 
-template <class T, class Allocator>
-vector<T, Allocator>::~vector() {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::~vector() {
+  StatsPolicy::on_destroy(_size, _capacity, sizeof(T));
   clear();
   shrink_to_fit();
 }
 
-template <class T, class Allocator>
-vector<T, Allocator> &vector<T, Allocator>::operator=(const vector &other) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy> &
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::operator=(
+    const vector &other) {
   if (this == &other) return *this;
-  clear();
-  if (allocator_traits::propagate_on_container_copy_assignment::value) {
-    shrink_to_fit();
+  if constexpr (allocator_traits::propagate_on_container_copy_assignment::
+                    value) {
+    if (_allocator != other._allocator) {
+      clear();
+      shrink_to_fit();
+    }
     _allocator = other._allocator;
   }
-  reserve(other._capacity);
-  for (auto it = other.begin(); it != other.end(); ++it) push_back(*it);
+  assign_range(other.begin(), other.end(), other._size);
   return *this;
 }
 
-template <class T, class Allocator>
-vector<T, Allocator> &vector<T, Allocator>::operator=(vector &&other) noexcept(
-    noexcept(allocator_traits::propagate_on_container_move_assignment::value ||
-             allocator_traits::is_always_equal::value)) {
-  clear();
-  shrink_to_fit();
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy> &
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::operator=(
+    vector &&other) noexcept(
+    allocator_traits::propagate_on_container_move_assignment::value ||
+    allocator_traits::is_always_equal::value) {
+  if (this == &other) return *this;
   if (allocator_traits::propagate_on_container_move_assignment::value ||
       _allocator == other._allocator) {
+    clear();
+    shrink_to_fit();
     _size = other._size;
     _capacity = other._capacity;
     _arr = other._arr;
     other._arr = nullptr;
     other._capacity = 0;
     other._size = 0;
-    if (allocator_traits::propagate_on_container_move_assignment::value)
-      _allocator = other._allocator;
+    if constexpr (allocator_traits::propagate_on_container_move_assignment::
+                      value)
+      _allocator = std::move(other._allocator);
   } else {
-    for (auto it = other.begin(); it != other.end(); ++it)
-      push_back(std::move(*it));
+    assign_range(std::make_move_iterator(other.begin()),
+                 std::make_move_iterator(other.end()), other._size);
     other.clear();
-    other.shrink_to_fit();
   }
   return *this;
 }
 
-template <class T, class Allocator>
-vector<T, Allocator> &vector<T, Allocator>::operator=(
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector<T, Allocator, GrowthPolicy, StatsPolicy> &
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::operator=(
     std::initializer_list<T> ilist) {
-  clear();
-  reserve(ilist.size());
-  for (auto it = ilist.begin(); it != ilist.end(); ++it) push_back(*it);
+  assign_range(ilist.begin(), ilist.end(), ilist.size());
   return *this;
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::assign(size_type count, const T &value) {
-  clear();
-  reserve(count);
-  while (_size != count) push_back(value);
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::assign(size_type count,
+                                                             const T &value) {
+  if (count > _capacity) {
+    clear();
+    shrink_to_fit();
+    reserve(count);
+    construct_at_end(count, value);
+  } else if (count <= _size) {
+    std::fill_n(_arr, count, value);
+    destroy_at_end(count);
+  } else {
+    std::fill_n(_arr, _size, value);
+    construct_at_end(count - _size, value);
+  }
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <class InputIt,
           std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
-void vector<T, Allocator>::assign(InputIt first, InputIt last) {
-  clear();
-  reserve(last - first);
-  for (; first != last; ++first) push_back(*first);
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::assign(InputIt first,
+                                                             InputIt last) {
+  assign_range(first, last, last - first);
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::assign(std::initializer_list<T> ilist) {
-  clear();
-  reserve(ilist.size());
-  for (auto it = ilist.begin(); it != ilist.end(); ++it) push_back(*it);
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::assign(
+    std::initializer_list<T> ilist) {
+  assign_range(ilist.begin(), ilist.end(), ilist.size());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::allocator_type
-vector<T, Allocator>::get_allocator() const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::allocator_type
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::get_allocator()
+    const noexcept {
   return _allocator;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::at(
-    size_type pos) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::reference
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::at(size_type pos) {
   if (pos >= _size) throw std::out_of_range("Index out of range");
   return *(_arr + pos);
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::at(
-    size_type pos) const {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_reference
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::at(size_type pos) const {
   if (pos >= _size) throw std::out_of_range("Index out of range");
   return *(_arr + pos);
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::operator[](
-    size_type pos) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::reference
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::operator[](size_type pos) {
   return *(_arr + pos);
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::operator[](
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_reference
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::operator[](
     size_type pos) const {
   return *(_arr + pos);
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::front() {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::reference
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::front() {
   return *_arr;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::front()
-    const {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_reference
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::front() const {
   return *_arr;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::back() {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::reference
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::back() {
   return *(_arr + _size - 1);
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::back()
-    const {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_reference
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::back() const {
   return *(_arr + _size - 1);
 }
 
-template <class T, class Allocator>
-T *vector<T, Allocator>::data() noexcept {
-  return _arr;
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+T *vector<T, Allocator, GrowthPolicy, StatsPolicy>::data() noexcept {
+  return assume_aligned<allocator_alignment_v<Allocator>>(_arr);
 }
 
-template <class T, class Allocator>
-const T *vector<T, Allocator>::data() const noexcept {
-  return _arr;
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+const T *vector<T, Allocator, GrowthPolicy, StatsPolicy>::data()
+    const noexcept {
+  return assume_aligned<allocator_alignment_v<Allocator>>(
+      static_cast<const T *>(_arr));
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::begin() noexcept {
-  iterator iter(_arr);
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::begin() noexcept {
+  iterator iter(data());
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_iterator vector<T, Allocator>::begin()
-    const noexcept {
-  const_iterator iter(_arr);
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::begin() const noexcept {
+  const_iterator iter(data());
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_iterator vector<T, Allocator>::cbegin()
-    const noexcept {
-  const_iterator iter(_arr);
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::cbegin() const noexcept {
+  const_iterator iter(data());
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::end() noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::end() noexcept {
   iterator iter(_arr + _size);
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_iterator vector<T, Allocator>::end()
-    const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::end() const noexcept {
   const_iterator iter(_arr + _size);
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_iterator vector<T, Allocator>::cend()
-    const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::cend() const noexcept {
   const_iterator iter(_arr + _size);
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::reverse_iterator
-vector<T, Allocator>::rbegin() noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::reverse_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::rbegin() noexcept {
   return reverse_iterator(end());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reverse_iterator
-vector<T, Allocator>::rbegin() const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_reverse_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::rbegin() const noexcept {
   return const_reverse_iterator(end());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reverse_iterator
-vector<T, Allocator>::crbegin() const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_reverse_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::crbegin() const noexcept {
   return const_reverse_iterator(cend());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::reverse_iterator
-vector<T, Allocator>::rend() noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::reverse_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::rend() noexcept {
   return reverse_iterator(begin());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reverse_iterator
-vector<T, Allocator>::rend() const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_reverse_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::rend() const noexcept {
   return const_reverse_iterator(begin());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reverse_iterator
-vector<T, Allocator>::crend() const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::const_reverse_iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::crend() const noexcept {
   return const_reverse_iterator(cbegin());
 }
 
-template <class T, class Allocator>
-bool vector<T, Allocator>::empty() const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+bool vector<T, Allocator, GrowthPolicy, StatsPolicy>::empty() const noexcept {
   return _size == 0;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::size_type vector<T, Allocator>::size()
-    const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::size_type
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::size() const noexcept {
   return _size;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::size_type vector<T, Allocator>::max_size()
-    const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::size_type
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::max_size() const noexcept {
   return allocator_traits::max_size(_allocator);
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::reserve(size_type new_cap) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::reserve(
+    size_type new_cap) {
   if (new_cap > max_size()) {
     throw std::length_error("Max size is bigger then new capacity");
   }
   if (new_cap <= _capacity) {
     return;
   }
+  if (_arr != nullptr && try_resize_in_place(new_cap)) return;
   T *new_arr = allocator_traits::allocate(_allocator, new_cap);
   move_to_new_arr(new_arr, 0, _size, 0, new_cap);
-  deallocate_old_arr();
-  _arr = new_arr;
-  _capacity = new_cap;
+  replace_arr(new_arr, new_cap);
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::size_type vector<T, Allocator>::capacity()
-    const noexcept {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::size_type
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::capacity() const noexcept {
   return _capacity;
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::shrink_to_fit() {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::shrink_to_fit() {
   if (_capacity == _size) {
     return;
   }
   if (_size != 0) {
+    if (try_resize_in_place(_size)) return;
     T *new_arr = allocator_traits::allocate(_allocator, _size);
     move_to_new_arr(new_arr, 0, _size, 0, _size);
-    deallocate_old_arr();
-    _arr = new_arr;
+    replace_arr(new_arr, _size);
   } else {
     deallocate_old_arr();
+    _capacity = 0;
   }
-  _capacity = _size;
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::clear() noexcept {
-  while (!empty()) pop_back();
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::clear() noexcept {
+  destroy_at_end(0);
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::insert(
     const_iterator pos, const T &value) {
   size_type insert_pos = pos - cbegin();
   if (_size == _capacity) {
@@ -540,9 +656,7 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
     move_to_new_arr(new_arr, 0, insert_pos, 0, new_cap);
     copy_to_new_arr(new_arr, insert_pos, 1, new_cap, value);
     move_to_new_arr(new_arr, insert_pos + 1, _size - insert_pos, -1, new_cap);
-    deallocate_old_arr();
-    _arr = new_arr;
-    _capacity = new_cap;
+    replace_arr(new_arr, new_cap);
   } else {
     shift_elements(pos, 1, true);
     allocator_traits::construct(_allocator, _arr + insert_pos, value);
@@ -552,8 +666,9 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::insert(
     const_iterator pos, T &&value) {
   size_type insert_pos = pos - cbegin();
   if (_size == _capacity) {
@@ -562,9 +677,7 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
     move_to_new_arr(new_arr, 0, insert_pos, 0, new_cap);
     move_to_new_arr(new_arr, insert_pos, new_cap, std::move(value));
     move_to_new_arr(new_arr, insert_pos + 1, _size - insert_pos, -1, new_cap);
-    deallocate_old_arr();
-    _arr = new_arr;
-    _capacity = new_cap;
+    replace_arr(new_arr, new_cap);
   } else {
     shift_elements(pos, 1, true);
     allocator_traits::construct(_allocator, _arr + insert_pos,
@@ -575,8 +688,9 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::insert(
     const_iterator pos, size_type count, const T &value) {
   size_type insert_pos = pos - cbegin();
   if (_size + count > _capacity) {
@@ -586,9 +700,7 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
     copy_to_new_arr(new_arr, insert_pos, count, new_cap, value);
     move_to_new_arr(new_arr, insert_pos + count, _size - insert_pos, -count,
                     new_cap);
-    deallocate_old_arr();
-    _arr = new_arr;
-    _capacity = new_cap;
+    replace_arr(new_arr, new_cap);
   } else {
     shift_elements(pos, count, true);
     for (size_type j = insert_pos; j < insert_pos + count; ++j)
@@ -599,10 +711,11 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
   return iter;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <class InputIt,
           std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::insert(
     const_iterator pos, InputIt first, InputIt last) {
   size_type count = last - first;
   size_type insert_pos = pos - cbegin();
@@ -613,9 +726,7 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
     copy_to_new_arr(new_arr, insert_pos, first, last, new_cap);
     move_to_new_arr(new_arr, insert_pos + count, _size - insert_pos, -count,
                     new_cap);
-    deallocate_old_arr();
-    _arr = new_arr;
-    _capacity = new_cap;
+    replace_arr(new_arr, new_cap);
   } else {
     shift_elements(pos, count, true);
     for (size_type j = insert_pos; first != last; ++first, ++j)
@@ -626,8 +737,9 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
   return iter;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::insert(
     const_iterator pos, std::initializer_list<T> ilist) {
   size_type count = ilist.size();
   size_type insert_pos = pos - cbegin();
@@ -638,9 +750,7 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
     copy_to_new_arr(new_arr, insert_pos, ilist.begin(), ilist.end(), new_cap);
     move_to_new_arr(new_arr, insert_pos + count, _size - insert_pos, -count,
                     new_cap);
-    deallocate_old_arr();
-    _arr = new_arr;
-    _capacity = new_cap;
+    replace_arr(new_arr, new_cap);
   } else {
     shift_elements(pos, count, true);
     auto it = ilist.begin();
@@ -652,23 +762,23 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
   return iter;
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::erase(const_iterator pos) {
-  allocator_traits::destroy(_allocator, _arr + (pos - cbegin()));
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::erase(
+    const_iterator pos) {
   shift_elements(pos, 1, false);
   --_size;
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::erase(const_iterator first, const_iterator last) {
-  for (auto it = first; it != last; ++it)
-    allocator_traits::destroy(_allocator, _arr + (it - cbegin()));
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::erase(
+    const_iterator first, const_iterator last) {
   shift_elements(first, last - first, false);
   _size -= (last - first);
 }
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <class... Args>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::emplace(
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::iterator
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::emplace(
     const_iterator pos, Args &&...args) {
   size_type emplace_pos = pos - cbegin();
   if (_size == _capacity) {
@@ -683,9 +793,7 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::emplace(
       throw;
     }
     move_to_new_arr(new_arr, emplace_pos + 1, _size - emplace_pos, -1, new_cap);
-    deallocate_old_arr();
-    _arr = new_arr;
-    _capacity = new_cap;
+    replace_arr(new_arr, new_cap);
   } else {
     shift_elements(pos, 1, true);
     allocator_traits::construct(_allocator, _arr + emplace_pos,
@@ -696,74 +804,200 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::emplace(
   return iter;
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::push_back(const T &value) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::push_back(
+    const T &value) {
   emplace_back(value);
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::push_back(T &&value) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::push_back(T &&value) {
   emplace_back(std::move(value));
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <class... Args>
-void vector<T, Allocator>::emplace_back(Args &&...args) {
-  if (_capacity == 0)
-    reserve(1);
-  else if (_size == _capacity)
-    reserve(_capacity * 2);
-  try {
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::emplace_back(
+    Args &&...args) {
+  if (_size == _capacity) {
+    emplace_back_grow(1, std::forward<Args>(args)...);
+  } else {
     allocator_traits::construct(_allocator, _arr + _size,
                                 std::forward<Args>(args)...);
+    ++_size;
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+template <class... Args>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::emplace_back_n(
+    size_type count, Args &&...args) {
+  if (count == 0) return;
+  if (count > _capacity - _size) {
+    emplace_back_grow(count, std::forward<Args>(args)...);
+  } else {
+    allocator_traits::construct(_allocator, _arr + _size,
+                                std::forward<Args>(args)...);
+    ++_size;
+  }
+  try {
+    construct_at_end(count - 1, _arr[_size - 1]);
   } catch (...) {
-    shrink_to_fit();
+    pop_back();
     throw;
   }
+}
+
+// The caller guarantees size() < capacity(), e.g. after reserve(); only
+// debug builds check it.
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::push_back_unchecked(
+    const T &value) {
+  assert(_size < _capacity);
+  allocator_traits::construct(_allocator, _arr + _size, value);
   ++_size;
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::pop_back() {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::push_back_unchecked(
+    T &&value) {
+  assert(_size < _capacity);
+  allocator_traits::construct(_allocator, _arr + _size, std::move(value));
+  ++_size;
+}
+
+// Sized ranges take one capacity check and go through construct_at_end,
+// which copies contiguous trivially copyable sources with memcpy. When the
+// vector has to grow, the range may point into it (even through reverse or
+// other adaptor iterators), so the new elements are built in the new buffer
+// while the old ones are still alive, the same order emplace_back uses.
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+template <class InputIt,
+          std::enable_if_t<!std::is_integral<InputIt>::value, bool>>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::append(InputIt first,
+                                                             InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (!std::is_base_of_v<std::forward_iterator_tag, category>) {
+    for (; first != last; ++first) emplace_back(*first);
+  } else {
+    size_type count = std::distance(first, last);
+    if (count == 0) return;
+    if (count <= _capacity - _size) {
+      construct_at_end(first, last);
+      return;
+    }
+    size_type new_cap = calculate_capacity(count);
+    T *new_arr = allocator_traits::allocate(_allocator, new_cap);
+    size_type built = _size;
+    size_type moved = 0;
+    try {
+      using source_type = typename std::iterator_traits<InputIt>::value_type;
+      if constexpr (is_contiguous_iterator_v<InputIt> &&
+                    std::is_trivially_copyable_v<T> &&
+                    std::is_same_v<std::remove_cv_t<source_type>, T>) {
+        std::memcpy(static_cast<void *>(new_arr + _size),
+                    static_cast<const void *>(std::addressof(*first)),
+                    count * sizeof(T));
+        built += count;
+      } else {
+        for (; first != last; ++first, ++built)
+          allocator_traits::construct(_allocator, new_arr + built, *first);
+      }
+      if constexpr (!is_trivially_relocatable_v<T>) {
+        for (; moved < _size; ++moved)
+          allocator_traits::construct(_allocator, new_arr + moved,
+                                      std::move_if_noexcept(_arr[moved]));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < moved; ++i)
+        allocator_traits::destroy(_allocator, new_arr + i);
+      for (size_type i = _size; i < built; ++i)
+        allocator_traits::destroy(_allocator, new_arr + i);
+      allocator_traits::deallocate(_allocator, new_arr, new_cap);
+      throw;
+    }
+    StatsPolicy::on_copy(count, count * sizeof(T));
+    record_transfer(_size);
+    if constexpr (is_trivially_relocatable_v<T>)
+      uninitialized_relocate_n(_arr, _size, new_arr);
+    replace_arr(new_arr, new_cap);
+    _size += count;
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::pop_back() {
   allocator_traits::destroy(_allocator, _arr + _size - 1);
   --_size;
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::resize(size_type count) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::resize(size_type count) {
+  if (count <= _size) {
+    destroy_at_end(count);
+  } else {
+    reserve(count);
+    construct_at_end(count - _size);
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::resize(
+    size_type count, const value_type &value) {
   if (count <= _size) {
-    while (count != _size) pop_back();
+    destroy_at_end(count);
   } else {
     reserve(count);
-    while (count != _size) push_back(T());
+    construct_at_end(count - _size, value);
   }
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::resize(size_type count, const value_type &value) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::resize(size_type count,
+                                                             default_init_t) {
   if (count <= _size) {
-    while (count != _size) pop_back();
+    destroy_at_end(count);
   } else {
     reserve(count);
-    while (count != _size) push_back(value);
+    construct_at_end(count - _size, default_init);
   }
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::swap(vector &other) noexcept(
-    noexcept(allocator_traits::propagate_on_container_swap::value ||
-             allocator_traits::is_always_equal::value)) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::resize_for_overwrite(
+    size_type count) {
+  resize(count, default_init);
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::swap(
+    vector &other) noexcept(
+    allocator_traits::propagate_on_container_swap::value ||
+    allocator_traits::is_always_equal::value) {
   std::swap(other._size, _size);
   std::swap(other._capacity, _capacity);
   std::swap(other._arr, _arr);
-  if (allocator_traits::propagate_on_container_swap::value)
+  if constexpr (allocator_traits::propagate_on_container_swap::value)
     std::swap(other._allocator, _allocator);
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::move_to_new_arr(T *new_arr, size_type pos,
-                                           size_type count, size_type shift,
-                                           size_type capacity_to_deallocate) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+vector_counters
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::stats() const noexcept {
+  vector_counters result = StatsPolicy::counters();
+  result.wasted_capacity = _capacity - _size;
+  return result;
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::move_to_new_arr(
+    T *new_arr, size_type pos, size_type count, size_type shift,
+    size_type capacity_to_deallocate) {
+  record_transfer(count);
+  if constexpr (is_trivially_relocatable_v<T>) {
+    uninitialized_relocate_n(_arr + (pos + shift), count, new_arr + pos);
+    return;
+  }
   size_type i = pos;
   try {
     for (; i < pos + count; ++i) {
@@ -779,10 +1013,10 @@ void vector<T, Allocator>::move_to_new_arr(T *new_arr, size_type pos,
   }
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::move_to_new_arr(T *new_arr, size_type pos,
-                                           size_type capacity_to_deallocate,
-                                           T &&value) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::move_to_new_arr(
+    T *new_arr, size_type pos, size_type capacity_to_deallocate, T &&value) {
+  record_transfer(1);
   try {
     allocator_traits::construct(_allocator, new_arr + pos,
                                 std::move_if_noexcept(value));
@@ -792,18 +1026,18 @@ void vector<T, Allocator>::move_to_new_arr(T *new_arr, size_type pos,
   }
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::copy_to_new_arr(T *new_arr, size_type pos,
-                                           size_type count,
-                                           size_type capacity_to_deallocate,
-                                           const T &value) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::copy_to_new_arr(
+    T *new_arr, size_type pos, size_type count,
+    size_type capacity_to_deallocate, const T &value) {
+  StatsPolicy::on_copy(count, count * sizeof(T));
   size_type i = pos;
   try {
     for (; i < pos + count; ++i) {
       allocator_traits::construct(_allocator, new_arr + i, value);
     }
   } catch (...) {
-    for (size_type j = 0; j < i; ++j) {
+    for (size_type j = is_trivially_relocatable_v<T> ? pos : 0; j < i; ++j) {
       allocator_traits::destroy(_allocator, new_arr + j);
     }
     allocator_traits::deallocate(_allocator, new_arr, capacity_to_deallocate);
@@ -811,51 +1045,264 @@ void vector<T, Allocator>::copy_to_new_arr(T *new_arr, size_type pos,
   }
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <class InputIt>
-void vector<T, Allocator>::copy_to_new_arr(T *new_arr, size_type pos,
-                                           InputIt first, InputIt last,
-                                           size_type capacity_to_deallocate) {
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::copy_to_new_arr(
+    T *new_arr, size_type pos, InputIt first, InputIt last,
+    size_type capacity_to_deallocate) {
   size_type i = pos;
   try {
     for (; first != last; ++first, ++i) {
       allocator_traits::construct(_allocator, new_arr + i, *first);
     }
   } catch (...) {
-    for (size_type j = 0; j < i; ++j) {
+    for (size_type j = is_trivially_relocatable_v<T> ? pos : 0; j < i; ++j) {
       allocator_traits::destroy(_allocator, new_arr + j);
     }
     allocator_traits::deallocate(_allocator, new_arr, capacity_to_deallocate);
     throw;
   }
+  StatsPolicy::on_copy(i - pos, (i - pos) * sizeof(T));
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::shift_elements(const_iterator pos, size_type shift,
-                                          bool to_right) {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::shift_elements(
+    const_iterator pos, size_type shift, bool to_right) {
+  if (shift == 0) return;
+  size_type index = pos - cbegin();
   if (to_right) {
-    size_type i = _size + shift - 1;
-    const_reverse_iterator end_it(pos);
-    for (auto it = rbegin(); it != end_it; ++it, --i) {
-      allocator_traits::construct(_allocator, _arr + i,
-                                  std::move_if_noexcept(*it));
-      allocator_traits::destroy(_allocator, _arr + i - shift);
+    size_type tail = _size - index;
+    record_transfer(tail);
+    if constexpr (is_trivially_relocatable_v<T>) {
+      if (tail != 0)
+        std::memmove(static_cast<void *>(_arr + index + shift),
+                     static_cast<const void *>(_arr + index),
+                     tail * sizeof(T));
+    } else {
+      // Elements that land past the old end are constructed, the others are
+      // move-assigned; the gap is left uninitialized for the caller.
+      size_type outside = tail < shift ? tail : shift;
+      for (size_type i = _size; i-- > _size - outside;)
+        allocator_traits::construct(_allocator, _arr + i + shift,
+                                    std::move_if_noexcept(_arr[i]));
+      std::move_backward(_arr + index, _arr + (_size - outside),
+                         _arr + (_size - outside + shift));
+      for (size_type i = index; i < index + outside; ++i)
+        allocator_traits::destroy(_allocator, _arr + i);
     }
   } else {
-    size_type i = pos - cbegin();
-    for (iterator it(_arr + i); it != end() - shift; ++it, ++i) {
-      allocator_traits::construct(_allocator, _arr + i,
-                                  std::move_if_noexcept(*(it + shift)));
-      allocator_traits::destroy(_allocator, _arr + i + shift);
+    record_transfer(_size - index - shift);
+    if constexpr (is_trivially_relocatable_v<T>) {
+      for (size_type i = index; i < index + shift; ++i)
+        allocator_traits::destroy(_allocator, _arr + i);
+      std::memmove(static_cast<void *>(_arr + index),
+                   static_cast<const void *>(_arr + index + shift),
+                   (_size - index - shift) * sizeof(T));
+    } else {
+      std::move(_arr + index + shift, _arr + _size, _arr + index);
+      for (size_type i = _size - shift; i < _size; ++i)
+        allocator_traits::destroy(_allocator, _arr + i);
     }
   }
 }
 
-template <class T, class Allocator>
-void vector<T, Allocator>::deallocate_old_arr() {
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::replace_arr(
+    T *new_arr, size_type new_cap) {
+  StatsPolicy::on_reallocation(_capacity, new_cap);
+  deallocate_old_arr();
+  _arr = new_arr;
+  _capacity = new_cap;
+  StatsPolicy::on_capacity(_capacity, sizeof(T));
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::record_transfer(
+    size_type count) noexcept {
+  if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                !std::is_copy_constructible_v<T>)
+    StatsPolicy::on_move(count, count * sizeof(T));
+  else
+    StatsPolicy::on_copy(count, count * sizeof(T));
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::construct_at_end(
+    size_type count) {
+  if constexpr (std::is_scalar_v<T> && !std::is_member_pointer_v<T>) {
+    if (count != 0) std::memset(_arr + _size, 0, count * sizeof(T));
+    _size += count;
+  } else if constexpr (std::is_trivial_v<T>) {
+    std::fill_n(_arr + _size, count, T());
+    _size += count;
+  } else {
+    size_type i = _size;
+    try {
+      for (; i != _size + count; ++i)
+        allocator_traits::construct(_allocator, _arr + i);
+    } catch (...) {
+      for (; i != _size; --i)
+        allocator_traits::destroy(_allocator, _arr + i - 1);
+      throw;
+    }
+    _size = i;
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::construct_at_end(
+    size_type count, const T &value) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::uninitialized_fill_n(_arr + _size, count, value);
+    _size += count;
+  } else {
+    size_type i = _size;
+    try {
+      for (; i != _size + count; ++i)
+        allocator_traits::construct(_allocator, _arr + i, value);
+    } catch (...) {
+      for (; i != _size; --i)
+        allocator_traits::destroy(_allocator, _arr + i - 1);
+      throw;
+    }
+    _size = i;
+  }
+}
+
+// Allocators cannot default-initialize through construct(), so types that
+// need a constructor call are value-initialized instead.
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::construct_at_end(
+    size_type count, default_init_t) {
+  if constexpr (std::is_trivially_default_constructible_v<T>) {
+    _size += count;
+  } else {
+    construct_at_end(count);
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+template <class InputIt>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::construct_at_end(
+    InputIt first, InputIt last) {
+  using source_type = typename std::iterator_traits<InputIt>::value_type;
+  if constexpr (std::is_trivially_copyable_v<T> &&
+                std::is_same_v<std::remove_cv_t<source_type>, T>) {
+    if constexpr (is_contiguous_iterator_v<InputIt>) {
+      size_type count = last - first;
+      if (count != 0)
+        std::memcpy(static_cast<void *>(_arr + _size),
+                    static_cast<const void *>(std::addressof(*first)),
+                    count * sizeof(T));
+      _size += count;
+    } else {
+      _size = std::uninitialized_copy(first, last, _arr + _size) - _arr;
+    }
+  } else {
+    size_type i = _size;
+    try {
+      for (; first != last; ++first, ++i)
+        allocator_traits::construct(_allocator, _arr + i, *first);
+    } catch (...) {
+      for (; i != _size; --i)
+        allocator_traits::destroy(_allocator, _arr + i - 1);
+      throw;
+    }
+    _size = i;
+  }
+}
+
+// Makes room for count new elements and builds the first of them. The
+// arguments may refer to an element of the vector, so they are used before
+// the old elements move: when reallocate() can move the block the element
+// is built aside and relocated in afterwards, otherwise it is built in the
+// new buffer, as append does.
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+template <class... Args>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::emplace_back_grow(
+    size_type count, Args &&...args) {
+  size_type new_cap = calculate_capacity(count);
+  if constexpr (is_trivially_relocatable_v<T> &&
+                allocator_has_reallocate_v<Allocator>) {
+    alignas(T) unsigned char storage[sizeof(T)];
+    T *value = reinterpret_cast<T *>(storage);
+    allocator_traits::construct(_allocator, value,
+                                std::forward<Args>(args)...);
+    try {
+      reserve(new_cap);
+    } catch (...) {
+      allocator_traits::destroy(_allocator, value);
+      throw;
+    }
+    uninitialized_relocate_n(value, 1, _arr + _size);
+  } else if (_arr != nullptr && try_resize_in_place(new_cap)) {
+    allocator_traits::construct(_allocator, _arr + _size,
+                                std::forward<Args>(args)...);
+  } else {
+    T *new_arr = allocator_traits::allocate(_allocator, new_cap);
+    bool built = false;
+    size_type moved = 0;
+    try {
+      allocator_traits::construct(_allocator, new_arr + _size,
+                                  std::forward<Args>(args)...);
+      built = true;
+      if constexpr (!is_trivially_relocatable_v<T>) {
+        for (; moved < _size; ++moved)
+          allocator_traits::construct(_allocator, new_arr + moved,
+                                      std::move_if_noexcept(_arr[moved]));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < moved; ++i)
+        allocator_traits::destroy(_allocator, new_arr + i);
+      if (built) allocator_traits::destroy(_allocator, new_arr + _size);
+      allocator_traits::deallocate(_allocator, new_arr, new_cap);
+      throw;
+    }
+    record_transfer(_size);
+    if constexpr (is_trivially_relocatable_v<T>)
+      uninitialized_relocate_n(_arr, _size, new_arr);
+    replace_arr(new_arr, new_cap);
+  }
+  ++_size;
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::destroy_at_end(
+    size_type new_size) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_type i = new_size; i != _size; ++i)
+      allocator_traits::destroy(_allocator, _arr + i);
+  }
+  _size = new_size;
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+bool vector<T, Allocator, GrowthPolicy, StatsPolicy>::try_resize_in_place(
+    size_type new_cap) {
+  if constexpr (is_trivially_relocatable_v<T> &&
+                allocator_has_reallocate_v<Allocator>) {
+    StatsPolicy::on_reallocation(_capacity, new_cap);
+    _arr = _allocator.reallocate(_arr, _capacity, new_cap);
+    _capacity = new_cap;
+    StatsPolicy::on_capacity(_capacity, sizeof(T));
+    return true;
+  } else if constexpr (allocator_has_try_expand_v<Allocator>) {
+    if (new_cap < _capacity ||
+        !_allocator.try_expand(_arr, _capacity, new_cap))
+      return false;
+    _capacity = new_cap;
+    StatsPolicy::on_capacity(_capacity, sizeof(T));
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::deallocate_old_arr() {
   if (_arr != nullptr) {
-    size_type temp_size = _size;
-    if (std::is_nothrow_move_constructible<T>::value == false) {
+    if constexpr (!is_trivially_relocatable_v<T>) {
+      size_type temp_size = _size;
       clear();
       _size = temp_size;
     }
@@ -864,172 +1311,233 @@ void vector<T, Allocator>::deallocate_old_arr() {
   _arr = nullptr;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::size_type
-vector<T, Allocator>::calculate_capacity(size_type count) {
-  size_type result = _capacity * 2;
-  if (result < _size + count) result = _size + count;
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+template <class InputIt>
+void vector<T, Allocator, GrowthPolicy, StatsPolicy>::assign_range(
+    InputIt first, InputIt last, size_type count) {
+  if (count > _capacity) {
+    clear();
+    shrink_to_fit();
+    reserve(count);
+    construct_at_end(first, last);
+  } else if (count <= _size) {
+    std::copy(first, last, _arr);
+    destroy_at_end(count);
+  } else {
+    InputIt middle = std::next(first, _size);
+    std::copy(first, middle, _arr);
+    construct_at_end(middle, last);
+  }
+}
+
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
+typename vector<T, Allocator, GrowthPolicy, StatsPolicy>::size_type
+vector<T, Allocator, GrowthPolicy, StatsPolicy>::calculate_capacity(
+    size_type count) {
+  size_type required = _size + count;
+  size_type result =
+      GrowthPolicy::template next_capacity<T>(_capacity, required);
+  if (result > max_size()) result = max_size();
+  if (result < required) result = required;
   return result;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-vector<T, Allocator>::common_iterator<IsConst>::common_iterator(
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::common_iterator(
     pointer ptr) noexcept
     : _ptr(ptr) {}
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-vector<T, Allocator>::common_iterator<IsConst>::common_iterator() noexcept
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::common_iterator() noexcept
     : _ptr(nullptr) {}
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-vector<T, Allocator>::common_iterator<IsConst>::operator common_iterator<true>()
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator common_iterator<true>()
     const noexcept {
   common_iterator<true> iter(_ptr);
   return iter;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>::reference
-vector<T, Allocator>::common_iterator<IsConst>::operator*() const {
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst>::reference
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator*() const {
   return *_ptr;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>::pointer
-vector<T, Allocator>::common_iterator<IsConst>::operator->() const {
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst>::pointer
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator->() const {
   return _ptr;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>::reference
-vector<T, Allocator>::common_iterator<IsConst>::operator[](
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst>::reference
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator[](
     difference_type n) const {
   return *(_ptr + n);
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>
-    &vector<T, Allocator>::common_iterator<IsConst>::operator++() {
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst> &
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator++() {
   ++_ptr;
   return *this;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>
-    &vector<T, Allocator>::common_iterator<IsConst>::operator--() {
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst> &
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator--() {
   --_ptr;
   return *this;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>
-vector<T, Allocator>::common_iterator<IsConst>::operator++(int) {
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst>
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator++(int) {
   auto tmp = *this;
   ++_ptr;
   return tmp;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>
-vector<T, Allocator>::common_iterator<IsConst>::operator--(int) {
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst>
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator--(int) {
   auto tmp = *this;
   --_ptr;
   return tmp;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>
-vector<T, Allocator>::common_iterator<IsConst>::operator+(
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst>
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator+(
     difference_type n) const {
   auto tmp = *this;
   tmp._ptr += n;
   return tmp;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst>
-vector<T, Allocator>::common_iterator<IsConst>::operator-(
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst>
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator-(
     difference_type n) const {
   auto tmp = *this;
   tmp._ptr -= n;
   return tmp;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst> &
-vector<T, Allocator>::common_iterator<IsConst>::operator+=(difference_type n) {
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst> &
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator+=(difference_type n) {
   _ptr += n;
   return *this;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T, Allocator>::template common_iterator<IsConst> &
-vector<T, Allocator>::common_iterator<IsConst>::operator-=(difference_type n) {
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst> &
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator-=(difference_type n) {
   _ptr -= n;
   return *this;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-typename vector<T,
-                Allocator>::template common_iterator<IsConst>::difference_type
-vector<T, Allocator>::common_iterator<IsConst>::operator-(
+typename vector<T, Allocator, GrowthPolicy,
+                StatsPolicy>::template common_iterator<IsConst>::difference_type
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator-(
     const common_iterator<true> &other) const {
   return _ptr - other._ptr;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-inline bool vector<T, Allocator>::common_iterator<IsConst>::operator==(
+inline bool
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator==(
     const common_iterator<true> &other) const noexcept {
   return _ptr == other._ptr;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-inline bool vector<T, Allocator>::common_iterator<IsConst>::operator!=(
+inline bool
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator!=(
     const common_iterator<true> &other) const noexcept {
   return _ptr != other._ptr;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-inline bool vector<T, Allocator>::common_iterator<IsConst>::operator<(
+inline bool
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator<(
     const common_iterator<true> &other) const noexcept {
   return _ptr < other._ptr;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-inline bool vector<T, Allocator>::common_iterator<IsConst>::operator<=(
+inline bool
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator<=(
     const common_iterator<true> &other) const noexcept {
   return _ptr <= other._ptr;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-inline bool vector<T, Allocator>::common_iterator<IsConst>::operator>(
+inline bool
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator>(
     const common_iterator<true> &other) const noexcept {
   return _ptr > other._ptr;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class GrowthPolicy, class StatsPolicy>
 template <bool IsConst>
-inline bool vector<T, Allocator>::common_iterator<IsConst>::operator>=(
+inline bool
+vector<T, Allocator, GrowthPolicy,
+       StatsPolicy>::common_iterator<IsConst>::operator>=(
     const common_iterator<true> &other) const noexcept {
   return _ptr >= other._ptr;
 }
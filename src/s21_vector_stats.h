@@ -0,0 +1,175 @@
+#ifndef S21_VECTOR_STATS_H_
+#define S21_VECTOR_STATS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+
+namespace s21 {
+
+struct vector_counters {
+  std::size_t reallocations = 0;
+  std::size_t elements_moved = 0;
+  std::size_t elements_copied = 0;
+  std::size_t bytes_moved = 0;
+  std::size_t peak_capacity = 0;
+  std::size_t wasted_capacity = 0;
+};
+
+// A stats policy receives the vector's operation events. no_vector_stats is
+// empty and all of its hooks are inline no-ops, so a vector that uses it has
+// the same layout and code as one without statistics.
+struct no_vector_stats {
+  void on_reallocation(std::size_t, std::size_t) noexcept {}
+  void on_move(std::size_t, std::size_t) noexcept {}
+  void on_copy(std::size_t, std::size_t) noexcept {}
+  void on_capacity(std::size_t, std::size_t) noexcept {}
+  void on_destroy(std::size_t, std::size_t, std::size_t) noexcept {}
+  vector_counters counters() const noexcept { return vector_counters(); }
+};
+
+// Process-wide totals of one stats tag. Every tag registers its totals in a
+// global list the first time a vector with that tag records an event.
+struct vector_stats_totals {
+  const char *tag;
+  vector_stats_totals *next;
+  std::atomic<std::size_t> instances{0};
+  std::atomic<std::size_t> reallocations{0};
+  std::atomic<std::size_t> elements_moved{0};
+  std::atomic<std::size_t> elements_copied{0};
+  std::atomic<std::size_t> bytes_moved{0};
+  std::atomic<std::size_t> peak_capacity_bytes{0};
+  std::atomic<std::size_t> wasted_bytes{0};
+
+  explicit vector_stats_totals(const char *name) noexcept;
+};
+
+inline std::atomic<vector_stats_totals *> vector_stats_registry{nullptr};
+
+// Writes the totals of every tag in the Prometheus text format. wasted_bytes
+// is the unused capacity that vectors still held when they were destroyed.
+void dump_vector_stats(std::ostream &os);
+
+// Counts events per instance and adds them to the totals of Tag. A tag is
+// any type; if it has a static `name` member the dump uses it as label.
+template <class Tag = void>
+class counting_vector_stats {
+ public:
+  counting_vector_stats() noexcept;
+
+  void on_reallocation(std::size_t old_capacity,
+                       std::size_t new_capacity) noexcept;
+  void on_move(std::size_t count, std::size_t bytes) noexcept;
+  void on_copy(std::size_t count, std::size_t bytes) noexcept;
+  void on_capacity(std::size_t capacity, std::size_t element_size) noexcept;
+  void on_destroy(std::size_t size, std::size_t capacity,
+                  std::size_t element_size) noexcept;
+  vector_counters counters() const noexcept;
+
+  static vector_stats_totals &totals() noexcept;
+
+ private:
+  template <class U, class = void>
+  struct tag_name {
+    static constexpr const char *value = "default";
+  };
+  template <class U>
+  struct tag_name<U, std::void_t<decltype(U::name)>> {
+    static constexpr const char *value = U::name;
+  };
+
+  vector_counters _counters;
+};
+
+inline vector_stats_totals::vector_stats_totals(const char *name) noexcept
+    : tag(name), next(vector_stats_registry.load()) {
+  while (!vector_stats_registry.compare_exchange_weak(next, this)) {
+  }
+}
+
+inline void dump_vector_stats(std::ostream &os) {
+  static const char *const names[] = {
+      "instances",       "reallocations",       "elements_moved",
+      "elements_copied", "bytes_moved",         "peak_capacity_bytes",
+      "wasted_bytes"};
+  for (vector_stats_totals *totals = vector_stats_registry.load();
+       totals != nullptr; totals = totals->next) {
+    const std::atomic<std::size_t> *values[] = {
+        &totals->instances,       &totals->reallocations,
+        &totals->elements_moved,  &totals->elements_copied,
+        &totals->bytes_moved,     &totals->peak_capacity_bytes,
+        &totals->wasted_bytes};
+    for (std::size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+      os << "s21_vector_" << names[i] << "{tag=\"" << totals->tag << "\"} "
+         << values[i]->load(std::memory_order_relaxed) << '\n';
+  }
+}
+
+template <class Tag>
+counting_vector_stats<Tag>::counting_vector_stats() noexcept {
+  totals().instances.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class Tag>
+void counting_vector_stats<Tag>::on_reallocation(std::size_t old_capacity,
+                                                 std::size_t) noexcept {
+  if (old_capacity == 0) return;
+  ++_counters.reallocations;
+  totals().reallocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class Tag>
+void counting_vector_stats<Tag>::on_move(std::size_t count,
+                                         std::size_t bytes) noexcept {
+  _counters.elements_moved += count;
+  _counters.bytes_moved += bytes;
+  totals().elements_moved.fetch_add(count, std::memory_order_relaxed);
+  totals().bytes_moved.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+template <class Tag>
+void counting_vector_stats<Tag>::on_copy(std::size_t count,
+                                         std::size_t bytes) noexcept {
+  _counters.elements_copied += count;
+  _counters.bytes_moved += bytes;
+  totals().elements_copied.fetch_add(count, std::memory_order_relaxed);
+  totals().bytes_moved.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+template <class Tag>
+void counting_vector_stats<Tag>::on_capacity(
+    std::size_t capacity, std::size_t element_size) noexcept {
+  if (capacity <= _counters.peak_capacity) return;
+  _counters.peak_capacity = capacity;
+  std::size_t bytes = capacity * element_size;
+  std::atomic<std::size_t> &peak = totals().peak_capacity_bytes;
+  std::size_t current = peak.load(std::memory_order_relaxed);
+  while (current < bytes &&
+         !peak.compare_exchange_weak(current, bytes,
+                                     std::memory_order_relaxed)) {
+  }
+}
+
+template <class Tag>
+void counting_vector_stats<Tag>::on_destroy(
+    std::size_t size, std::size_t capacity,
+    std::size_t element_size) noexcept {
+  totals().wasted_bytes.fetch_add((capacity - size) * element_size,
+                                  std::memory_order_relaxed);
+}
+
+template <class Tag>
+vector_counters counting_vector_stats<Tag>::counters() const noexcept {
+  return _counters;
+}
+
+template <class Tag>
+vector_stats_totals &counting_vector_stats<Tag>::totals() noexcept {
+  static vector_stats_totals result(tag_name<Tag>::value);
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // S21_VECTOR_STATS_H_